@@ -0,0 +1,38 @@
+#ifndef BENCH_UTIL_H
+#define BENCH_UTIL_H
+
+#include <chrono>
+#include <fstream>
+#include <functional>
+#include <iostream>
+#include <unistd.h>
+#include <sys/wait.h>
+
+// Helpers shared by the list1 benchmarks.
+
+inline double elapsed_ms(std::chrono::steady_clock::time_point since) {
+    return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - since).count();
+}
+
+// Current resident set of this process.
+inline long resident_kb() {
+    std::ifstream statm("/proc/self/statm");
+    long size = 0, resident = 0;
+    statm >> size >> resident;
+    return resident * (sysconf(_SC_PAGESIZE) / 1024);
+}
+
+// Runs body in a child process and waits for it, so each run starts from a clean heap:
+// memory freed by one run cannot be reused by the next, and peak RSS belongs to one run.
+inline void run_isolated(const std::function<void()>& body) {
+    std::cout.flush();
+    pid_t pid = fork();
+    if (pid == 0) {
+        body();
+        std::cout.flush();
+        _exit(0);
+    }
+    waitpid(pid, nullptr, 0);
+}
+
+#endif // BENCH_UTIL_H
@@ -0,0 +1,91 @@
+#include <iostream>
+#include <iomanip>
+#include <string>
+#include <vector>
+#include <chrono>
+#include <functional>
+
+#include "fifo_lifo.h"
+#include "chunked_fifo_lifo.h"
+#include "bench_util.h"
+
+const std::size_t BULK = 256;
+
+struct Result {
+    double pushSeconds;
+    double popSeconds;
+    long memoryKb;
+};
+
+// fill() pushes n elements, drain() pops them back; the memory figure is the growth of
+// the resident set while the container was full.
+Result measure(const std::function<void()>& fill, const std::function<void()>& drain) {
+    long before = resident_kb();
+    auto t0 = std::chrono::steady_clock::now();
+    fill();
+    auto t1 = std::chrono::steady_clock::now();
+    long full = resident_kb();
+    drain();
+    auto t2 = std::chrono::steady_clock::now();
+    return {std::chrono::duration<double>(t1 - t0).count(),
+            std::chrono::duration<double>(t2 - t1).count(),
+            full - before};
+}
+
+// Each container runs in its own process so memory freed by one run cannot be reused by
+// the next and hide its footprint.
+void run_isolated(const std::string& name, long long n, const std::function<Result()>& body) {
+    run_isolated([&] {
+        Result r = body();
+        double mops = 2.0 * n / (r.pushSeconds + r.popSeconds) / 1e6;
+        std::cout << std::left << std::setw(22) << name << std::right << std::fixed
+                  << std::setprecision(3) << std::setw(10) << r.pushSeconds
+                  << std::setw(10) << r.popSeconds
+                  << std::setprecision(2) << std::setw(12) << mops
+                  << std::setw(12) << r.memoryKb / 1024.0 << std::endl;
+    });
+}
+
+int main(int argc, char* argv[]) {
+    long long n = argc >= 2 ? std::stoll(argv[1]) : 10000000;
+
+    std::cout << "n = " << n << ", chunk = " << CHUNK_CAPACITY << " ints" << std::endl;
+    std::cout << "Container               push [s]  pop [s]     Mops/s  memory [MB]" << std::endl;
+
+    run_isolated("FIFO", n, [n] {
+        FIFO q(false);
+        return measure([&] { for (long long i = 0; i < n; i++) q.push(i); },
+                       [&] { for (long long i = 0; i < n; i++) q.pop(); });
+    });
+    run_isolated("ChunkedFIFO", n, [n] {
+        ChunkedFIFO q;
+        int x;
+        return measure([&] { for (long long i = 0; i < n; i++) q.push(i); },
+                       [&] { for (long long i = 0; i < n; i++) q.pop(x); });
+    });
+    run_isolated("ChunkedFIFO bulk", n, [n] {
+        ChunkedFIFO q;
+        std::vector<int> buf(BULK);
+        return measure([&] { for (long long i = 0; i < n; i += BULK) q.push_n(buf.data(), std::min<long long>(BULK, n - i)); },
+                       [&] { while (q.pop_n(buf.data(), BULK) > 0) {} });
+    });
+    run_isolated("LIFO", n, [n] {
+        LIFO s(false);
+        return measure([&] { for (long long i = 0; i < n; i++) s.push(i); },
+                       [&] { for (long long i = 0; i < n; i++) s.pop(); });
+    });
+    run_isolated("ChunkedLIFO", n, [n] {
+        ChunkedLIFO s;
+        int x;
+        return measure([&] { for (long long i = 0; i < n; i++) s.push(i); },
+                       [&] { for (long long i = 0; i < n; i++) s.pop(x); });
+    });
+    run_isolated("ChunkedLIFO bulk", n, [n] {
+        ChunkedLIFO s;
+        std::vector<int> buf(BULK);
+        return measure([&] { for (long long i = 0; i < n; i += BULK) s.push_n(buf.data(), std::min<long long>(BULK, n - i)); },
+                       [&] { while (s.pop_n(buf.data(), BULK) > 0) {} });
+    });
+
+    return 0;
+}
@@ -0,0 +1,155 @@
+#ifndef CHUNKED_CYCLIC_LIST_H
+#define CHUNKED_CYCLIC_LIST_H
+
+#include <iostream>
+#include <cstdint>
+
+#if defined(__AVX2__) || defined(__SSE2__)
+#include <immintrin.h>
+#endif
+
+// Cyclic list whose nodes hold up to KEYS_PER_NODE keys in an aligned array. search()
+// compares a whole node at once with SSE2/AVX2 (cmpeq + movemask) and falls back to a
+// scalar loop when neither is available at compile time.
+
+const int KEYS_PER_NODE = 32;
+
+struct alignas(64) ChunkNode {
+    int keys[KEYS_PER_NODE];
+    int count;
+    ChunkNode* next;
+    ChunkNode() : keys{}, count(0), next(nullptr) {}
+};
+
+struct SearchResult {
+    bool found;
+    int comparisons;     // keys examined up to and including the match, as in CyclicList::search
+    int vectorCompares;  // SIMD compare instructions issued (scalar build: equals comparisons)
+};
+
+// Bitmask of the first `count` keys of `node` equal to value, bit i set for keys[i].
+// vectorCompares is increased by the number of compare instructions used.
+inline std::uint32_t match_mask(const ChunkNode* node, int value, int& vectorCompares) {
+    std::uint32_t mask = 0;
+#if defined(__AVX2__)
+    __m256i needle = _mm256_set1_epi32(value);
+    for (int i = 0; i < node->count; i += 8) {
+        __m256i block = _mm256_load_si256(reinterpret_cast<const __m256i*>(node->keys + i));
+        __m256i eq = _mm256_cmpeq_epi32(block, needle);
+        mask |= static_cast<std::uint32_t>(_mm256_movemask_ps(_mm256_castsi256_ps(eq))) << i;
+        vectorCompares++;
+    }
+#elif defined(__SSE2__)
+    __m128i needle = _mm_set1_epi32(value);
+    for (int i = 0; i < node->count; i += 4) {
+        __m128i block = _mm_load_si128(reinterpret_cast<const __m128i*>(node->keys + i));
+        __m128i eq = _mm_cmpeq_epi32(block, needle);
+        mask |= static_cast<std::uint32_t>(_mm_movemask_ps(_mm_castsi128_ps(eq))) << i;
+        vectorCompares++;
+    }
+#else
+    for (int i = 0; i < node->count; i++) {
+        mask |= static_cast<std::uint32_t>(node->keys[i] == value) << i;
+        vectorCompares++;
+    }
+#endif
+    if (node->count < KEYS_PER_NODE) {
+        mask &= (std::uint32_t(1) << node->count) - 1;
+    }
+    return mask;
+}
+
+class ChunkedCyclicList {
+public:
+    ChunkNode* head;
+    int size;
+
+    ChunkedCyclicList() : head(nullptr), size(0) {}
+
+    ~ChunkedCyclicList() {
+        if (!head) {
+            return;
+        }
+        ChunkNode* current = head->next;
+        while (current != head) {
+            ChunkNode* tmp = current;
+            current = current->next;
+            delete tmp;
+        }
+        delete head;
+    }
+
+    ChunkedCyclicList(const ChunkedCyclicList&) = delete;
+    ChunkedCyclicList& operator=(const ChunkedCyclicList&) = delete;
+
+    // Keys go into the head node; when it is full a fresh node is linked in after it and
+    // becomes the new head, so only the head can ever be partially filled.
+    void insert(int value) {
+        if (!head) {
+            head = new ChunkNode;
+            head->next = head;
+        } else if (head->count == KEYS_PER_NODE) {
+            ChunkNode* newNode = new ChunkNode;
+            newNode->next = head->next;
+            head->next = newNode;
+            head = newNode;
+        }
+        head->keys[head->count++] = value;
+        size++;
+    }
+
+    // O(1) splice of the two rings, exactly like CyclicList::merge. Partially filled
+    // nodes are kept as they are.
+    void merge(ChunkedCyclicList& list2) {
+        if (!list2.head) {
+            return;
+        }
+        if (!head) {
+            head = list2.head;
+        } else {
+            ChunkNode* tmp = head->next;
+            head->next = list2.head->next;
+            list2.head->next = tmp;
+        }
+
+        size += list2.size;
+        list2.head = nullptr;
+        list2.size = 0;
+    }
+
+    SearchResult search(int value) const {
+        SearchResult result{false, 0, 0};
+        if (!head) {
+            return result;
+        }
+        const ChunkNode* current = head;
+        do {
+            std::uint32_t mask = match_mask(current, value, result.vectorCompares);
+            if (mask) {
+                result.found = true;
+                result.comparisons += __builtin_ctz(mask) + 1;
+                return result;
+            }
+            result.comparisons += current->count;
+            current = current->next;
+        } while (current != head);
+        return result;
+    }
+
+    void print() const {
+        if (!head) {
+            std::cout << "List is empty\n";
+            return;
+        }
+        const ChunkNode* tmp = head;
+        do {
+            for (int i = 0; i < tmp->count; i++) {
+                std::cout << tmp->keys[i] << " ";
+            }
+            tmp = tmp->next;
+        } while (tmp != head);
+        std::cout << std::endl;
+    }
+};
+
+#endif // CHUNKED_CYCLIC_LIST_H
@@ -0,0 +1,257 @@
+#ifndef CHUNKED_FIFO_LIFO_H
+#define CHUNKED_FIFO_LIFO_H
+
+#include <cstddef>
+#include <cstring>
+#include <algorithm>
+
+// Unrolled variants of FIFO and LIFO: elements live in cache-line-aligned chunks of
+// CHUNK_CAPACITY ints linked together, so one allocation serves hundreds of pushes and
+// traversal is sequential within a chunk. Emptied chunks go to a small free list and are
+// reused before asking the allocator again.
+
+const std::size_t CHUNK_BYTES = 1024;
+const std::size_t CHUNK_CAPACITY = (CHUNK_BYTES - sizeof(void*)) / sizeof(int);
+const std::size_t MAX_SPARE_CHUNKS = 4;
+
+struct alignas(64) Chunk {
+    int data[CHUNK_CAPACITY];
+    Chunk* next;
+};
+
+static_assert(sizeof(Chunk) == CHUNK_BYTES, "Chunk should fill exactly CHUNK_BYTES");
+
+class ChunkPool {
+private:
+    Chunk* spare;
+    std::size_t spareCount;
+public:
+    ChunkPool() : spare(nullptr), spareCount(0) {}
+
+    ~ChunkPool() {
+        while (spare) {
+            Chunk* tmp = spare;
+            spare = spare->next;
+            delete tmp;
+        }
+    }
+
+    Chunk* acquire() {
+        Chunk* chunk;
+        if (spare) {
+            chunk = spare;
+            spare = spare->next;
+            spareCount--;
+        } else {
+            chunk = new Chunk;
+        }
+        chunk->next = nullptr;
+        return chunk;
+    }
+
+    void release(Chunk* chunk) {
+        if (spareCount >= MAX_SPARE_CHUNKS) {
+            delete chunk;
+            return;
+        }
+        chunk->next = spare;
+        spare = chunk;
+        spareCount++;
+    }
+};
+
+class ChunkedFIFO {
+private:
+    Chunk* head;
+    Chunk* tail;
+    std::size_t headIndex;
+    std::size_t tailIndex;
+    std::size_t count;
+    ChunkPool pool;
+
+public:
+    ChunkedFIFO() : head(nullptr), tail(nullptr), headIndex(0), tailIndex(0), count(0) {}
+
+    ~ChunkedFIFO() {
+        while (head) {
+            Chunk* tmp = head;
+            head = head->next;
+            delete tmp;
+        }
+    }
+
+    ChunkedFIFO(const ChunkedFIFO&) = delete;
+    ChunkedFIFO& operator=(const ChunkedFIFO&) = delete;
+
+    void push(int item) {
+        if (!tail || tailIndex == CHUNK_CAPACITY) {
+            grow();
+        }
+        tail->data[tailIndex++] = item;
+        count++;
+    }
+
+    bool pop(int& item) {
+        if (count == 0) {
+            return false;
+        }
+        item = head->data[headIndex++];
+        count--;
+        advance();
+        return true;
+    }
+
+    void push_n(const int* items, std::size_t n) {
+        while (n > 0) {
+            if (!tail || tailIndex == CHUNK_CAPACITY) {
+                grow();
+            }
+            std::size_t k = std::min(n, CHUNK_CAPACITY - tailIndex);
+            std::memcpy(tail->data + tailIndex, items, k * sizeof(int));
+            tailIndex += k;
+            count += k;
+            items += k;
+            n -= k;
+        }
+    }
+
+    std::size_t pop_n(int* items, std::size_t n) {
+        n = std::min(n, count);
+        std::size_t popped = 0;
+        while (popped < n) {
+            std::size_t end = head == tail ? tailIndex : CHUNK_CAPACITY;
+            std::size_t k = std::min(n - popped, end - headIndex);
+            std::memcpy(items + popped, head->data + headIndex, k * sizeof(int));
+            headIndex += k;
+            count -= k;
+            popped += k;
+            advance();
+        }
+        return popped;
+    }
+
+    std::size_t size() const { return count; }
+    bool empty() const { return count == 0; }
+
+private:
+    void grow() {
+        Chunk* chunk = pool.acquire();
+        if (tail) {
+            tail->next = chunk;
+        } else {
+            head = chunk;
+            headIndex = 0;
+        }
+        tail = chunk;
+        tailIndex = 0;
+    }
+
+    // Releases the head chunk once it has been fully consumed.
+    void advance() {
+        if (head == tail) {
+            if (headIndex == tailIndex) {
+                headIndex = tailIndex = 0;
+            }
+        } else if (headIndex == CHUNK_CAPACITY) {
+            Chunk* tmp = head;
+            head = head->next;
+            headIndex = 0;
+            pool.release(tmp);
+        }
+    }
+};
+
+class ChunkedLIFO {
+private:
+    Chunk* top;
+    std::size_t topIndex;
+    std::size_t count;
+    ChunkPool pool;
+
+public:
+    ChunkedLIFO() : top(nullptr), topIndex(0), count(0) {}
+
+    ~ChunkedLIFO() {
+        while (top) {
+            Chunk* tmp = top;
+            top = top->next;
+            delete tmp;
+        }
+    }
+
+    ChunkedLIFO(const ChunkedLIFO&) = delete;
+    ChunkedLIFO& operator=(const ChunkedLIFO&) = delete;
+
+    void push(int item) {
+        if (!top || topIndex == CHUNK_CAPACITY) {
+            grow();
+        }
+        top->data[topIndex++] = item;
+        count++;
+    }
+
+    bool pop(int& item) {
+        if (count == 0) {
+            return false;
+        }
+        item = top->data[--topIndex];
+        count--;
+        shrink();
+        return true;
+    }
+
+    void push_n(const int* items, std::size_t n) {
+        while (n > 0) {
+            if (!top || topIndex == CHUNK_CAPACITY) {
+                grow();
+            }
+            std::size_t k = std::min(n, CHUNK_CAPACITY - topIndex);
+            std::memcpy(top->data + topIndex, items, k * sizeof(int));
+            topIndex += k;
+            count += k;
+            items += k;
+            n -= k;
+        }
+    }
+
+    // Pops up to n items; items[0] is the most recently pushed one.
+    std::size_t pop_n(int* items, std::size_t n) {
+        n = std::min(n, count);
+        std::size_t popped = 0;
+        while (popped < n) {
+            std::size_t k = std::min(n - popped, topIndex);
+            for (std::size_t i = 0; i < k; i++) {
+                items[popped + i] = top->data[topIndex - 1 - i];
+            }
+            topIndex -= k;
+            count -= k;
+            popped += k;
+            shrink();
+        }
+        return popped;
+    }
+
+    std::size_t size() const { return count; }
+    bool empty() const { return count == 0; }
+
+private:
+    void grow() {
+        Chunk* chunk = pool.acquire();
+        chunk->next = top;
+        top = chunk;
+        topIndex = 0;
+    }
+
+    // Steps down to the previous chunk once the top one is empty; the empty chunk goes
+    // back to the pool so pushing across a chunk boundary does not hit the allocator.
+    void shrink() {
+        if (topIndex == 0 && top->next) {
+            Chunk* tmp = top;
+            top = top->next;
+            topIndex = CHUNK_CAPACITY;
+            pool.release(tmp);
+        }
+    }
+};
+
+#endif // CHUNKED_FIFO_LIFO_H
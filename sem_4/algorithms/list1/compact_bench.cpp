@@ -0,0 +1,85 @@
+#include <iostream>
+#include <iomanip>
+#include <string>
+#include <vector>
+#include <random>
+#include <chrono>
+
+#include "cyclic_list.h"
+#include "double_cyclic_list.h"
+#include "bench_util.h"
+
+// Usage: ./compact_bench [n] [walks]
+// Builds an n-node list from 64 side lists filled round-robin and merged, so neighbours on
+// the ring were allocated far apart. sort() then relinks the nodes by key, which scatters
+// the ring over the whole heap. compact() moves the nodes back into traversal order.
+// Each stage reports the average time of a full walk (search for an absent key).
+
+template <typename List, typename Search>
+void measure(const std::string& name, int n, int walks, Search search) {
+    std::mt19937 rng(12345);
+    std::uniform_int_distribution<int> keys(0, 1000000000);
+
+    const int PIECES = 64;
+    std::vector<List> pieces(PIECES);
+    for (int i = 0; i < n; i++) {
+        pieces[i % PIECES].insert(keys(rng));
+    }
+    List list;
+    list.insert(keys(rng));
+    for (List& piece : pieces) {
+        list.merge(piece);
+    }
+
+    volatile int sink;
+    auto walk = [&](const std::string& stage, double stageMs) {
+        auto start = std::chrono::steady_clock::now();
+        for (int w = 0; w < walks; w++) {
+            sink = search(list, -1 - w);
+        }
+        std::cout << std::left << std::setw(18) << name << std::setw(16) << stage << std::right
+                  << std::fixed << std::setprecision(1) << std::setw(14) << stageMs
+                  << std::setw(14) << elapsed_ms(start) / walks << std::endl;
+    };
+    (void)sink;
+
+    walk("merged", 0.0);
+
+    auto start = std::chrono::steady_clock::now();
+    list.sort();
+    walk("sorted", elapsed_ms(start));
+
+    bool ok = true;
+    auto current = list.head;
+    for (int i = 1; i < list.size; i++) {
+        ok = ok && current->data <= current->next->data;
+        current = current->next;
+    }
+    if (!ok) {
+        std::cout << name << ": sort() produced an unsorted ring" << std::endl;
+    }
+
+    start = std::chrono::steady_clock::now();
+    list.compact();
+    walk("compacted", elapsed_ms(start));
+}
+
+int main(int argc, char* argv[]) {
+    int n = argc >= 2 ? std::stoi(argv[1]) : 10000000;
+    int walks = argc >= 3 ? std::stoi(argv[2]) : 5;
+
+    std::cout << "n = " << n << ", " << walks << " walks per stage" << std::endl;
+    std::cout << "List              Stage           stage [ms]     walk [ms]" << std::endl;
+
+    run_isolated([n, walks] {
+        measure<CyclicList>("CyclicList", n, walks, [](CyclicList& list, int key) { return list.search(key); });
+    });
+    // DoubleCyclicList::search picks a random direction; both run over the same layout.
+    run_isolated([n, walks] {
+        std::mt19937 rng(1);
+        measure<DoubleCyclicList>("DoubleCyclicList", n, walks,
+                                  [&](DoubleCyclicList& list, int key) { return list.search(key, rng); });
+    });
+
+    return 0;
+}
@@ -0,0 +1,155 @@
+#ifndef CONCURRENT_LIFO_H
+#define CONCURRENT_LIFO_H
+
+#include <algorithm>
+#include <atomic>
+#include <cstdlib>
+#include <iostream>
+#include <vector>
+
+// Lock-free LIFO (Treiber stack) with hazard pointers. A thread that is about to read a
+// node's next pointer first publishes the node in its hazard slot; popped nodes are only
+// deleted once no hazard slot points to them. That makes the reads safe and also rules
+// out ABA on top, since a node address cannot be reused while someone still holds it.
+
+const int HAZARD_MAX_THREADS = 128;
+const std::size_t RETIRE_THRESHOLD = 2 * HAZARD_MAX_THREADS;
+
+inline std::atomic<bool> hazardIdTaken[HAZARD_MAX_THREADS];
+
+// Small dense id for the calling thread, returned to the pool when the thread exits so
+// short-lived threads do not run out of slots.
+inline int hazard_thread_id() {
+    struct Registration {
+        int id;
+        Registration() : id(-1) {
+            for (int i = 0; i < HAZARD_MAX_THREADS; i++) {
+                bool expected = false;
+                if (hazardIdTaken[i].compare_exchange_strong(expected, true)) {
+                    id = i;
+                    return;
+                }
+            }
+            std::cerr << "More than " << HAZARD_MAX_THREADS << " threads use ConcurrentLIFO" << std::endl;
+            std::abort();
+        }
+        ~Registration() {
+            hazardIdTaken[id].store(false);
+        }
+    };
+    thread_local Registration registration;
+    return registration.id;
+}
+
+class ConcurrentLIFO {
+private:
+    struct StackNode {
+        int data;
+        StackNode* next;
+        StackNode(int val) : data(val), next(nullptr) {}
+    };
+
+    struct alignas(64) HazardSlot {
+        std::atomic<StackNode*> pointer{nullptr};
+    };
+
+    struct alignas(64) RetiredList {
+        std::vector<StackNode*> nodes;
+    };
+
+    alignas(64) std::atomic<StackNode*> top;
+    HazardSlot hazards[HAZARD_MAX_THREADS];
+    RetiredList retired[HAZARD_MAX_THREADS];
+
+    void retire(int id, StackNode* node) {
+        std::vector<StackNode*>& list = retired[id].nodes;
+        list.push_back(node);
+        if (list.size() >= RETIRE_THRESHOLD) {
+            scan(list);
+        }
+    }
+
+    // Deletes every retired node that no thread has published as hazardous.
+    void scan(std::vector<StackNode*>& list) {
+        std::vector<StackNode*> protectedNodes;
+        for (const HazardSlot& slot : hazards) {
+            StackNode* p = slot.pointer.load(std::memory_order_acquire);
+            if (p) {
+                protectedNodes.push_back(p);
+            }
+        }
+        std::sort(protectedNodes.begin(), protectedNodes.end());
+
+        std::vector<StackNode*> keep;
+        for (StackNode* node : list) {
+            if (std::binary_search(protectedNodes.begin(), protectedNodes.end(), node)) {
+                keep.push_back(node);
+            } else {
+                delete node;
+            }
+        }
+        list.swap(keep);
+    }
+
+public:
+    ConcurrentLIFO() : top(nullptr) {}
+
+    ~ConcurrentLIFO() {
+        StackNode* current = top.load();
+        while (current) {
+            StackNode* tmp = current;
+            current = current->next;
+            delete tmp;
+        }
+        for (RetiredList& list : retired) {
+            for (StackNode* node : list.nodes) {
+                delete node;
+            }
+        }
+    }
+
+    ConcurrentLIFO(const ConcurrentLIFO&) = delete;
+    ConcurrentLIFO& operator=(const ConcurrentLIFO&) = delete;
+
+    void push(int item) {
+        StackNode* newNode = new StackNode(item);
+        newNode->next = top.load(std::memory_order_relaxed);
+        while (!top.compare_exchange_weak(newNode->next, newNode,
+                                          std::memory_order_release, std::memory_order_relaxed)) {
+        }
+    }
+
+    // Returns false when the stack is empty.
+    bool pop(int& item) {
+        int id = hazard_thread_id();
+        std::atomic<StackNode*>& hazard = hazards[id].pointer;
+        StackNode* old = top.load(std::memory_order_acquire);
+        while (true) {
+            if (!old) {
+                hazard.store(nullptr, std::memory_order_release);
+                return false;
+            }
+            hazard.store(old, std::memory_order_seq_cst);
+            // Re-check after publishing: if top moved, old may already have been retired.
+            StackNode* current = top.load(std::memory_order_seq_cst);
+            if (current != old) {
+                old = current;
+                continue;
+            }
+            if (top.compare_exchange_weak(old, old->next,
+                                          std::memory_order_acquire, std::memory_order_acquire)) {
+                break;
+            }
+        }
+        hazard.store(nullptr, std::memory_order_release);
+        item = old->data;
+        retire(id, old);
+        return true;
+    }
+
+    bool empty() const {
+        return top.load(std::memory_order_acquire) == nullptr;
+    }
+};
+
+#endif // CONCURRENT_LIFO_H
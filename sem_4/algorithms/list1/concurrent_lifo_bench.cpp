@@ -0,0 +1,90 @@
+#include <iostream>
+#include <iomanip>
+#include <vector>
+#include <thread>
+#include <mutex>
+#include <atomic>
+#include <chrono>
+
+#include "fifo_lifo.h"
+#include "concurrent_lifo.h"
+
+struct LockedLIFO {
+    LIFO lifo{false};
+    std::mutex mtx;
+
+    void push(int item) {
+        std::lock_guard<std::mutex> lock(mtx);
+        lifo.push(item);
+    }
+
+    bool pop(int& item) {
+        std::lock_guard<std::mutex> lock(mtx);
+        if (lifo.empty()) {
+            return false;
+        }
+        item = 0;
+        lifo.pop();
+        return true;
+    }
+};
+
+// Every thread alternates push and pop; returns total operations per second.
+template <typename Stack>
+double run(Stack& stack, int threads, long long opsPerThread) {
+    std::vector<std::thread> workers;
+    auto start = std::chrono::steady_clock::now();
+    for (int t = 0; t < threads; t++) {
+        workers.emplace_back([&, t] {
+            int item;
+            for (long long i = 0; i < opsPerThread / 2; i++) {
+                stack.push(t);
+                stack.pop(item);
+            }
+        });
+    }
+    for (auto& w : workers) w.join();
+    std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+    return threads * (opsPerThread / 2) * 2 / elapsed.count();
+}
+
+// Threads push disjoint ranges and pop concurrently; every value must come out exactly once.
+bool check(int threads, int perThread) {
+    ConcurrentLIFO stack;
+    std::vector<std::atomic<int>> seen(threads * perThread);
+    for (auto& s : seen) s.store(0);
+    std::vector<std::thread> workers;
+    for (int t = 0; t < threads; t++) {
+        workers.emplace_back([&, t] {
+            int item;
+            for (int i = 0; i < perThread; i++) {
+                stack.push(t * perThread + i);
+                if (i % 3 == 0 && stack.pop(item)) seen[item].fetch_add(1);
+            }
+            while (stack.pop(item)) seen[item].fetch_add(1);
+        });
+    }
+    for (auto& w : workers) w.join();
+    for (auto& s : seen) {
+        if (s.load() != 1) return false;
+    }
+    return true;
+}
+
+int main(int argc, char* argv[]) {
+    long long ops = argc >= 2 ? std::stoll(argv[1]) : 2000000;
+    int maxThreads = argc >= 3 ? std::stoi(argv[2]) : 32;
+
+    std::cout << "Correctness check: " << (check(8, 100000) ? "OK" : "FAILED") << std::endl;
+    std::cout << "Operations per thread: " << ops << std::endl;
+    std::cout << "Threads  LIFO + mutex [Mops/s]  ConcurrentLIFO [Mops/s]" << std::endl;
+    for (int threads = 1; threads <= maxThreads; threads *= 2) {
+        LockedLIFO locked;
+        ConcurrentLIFO lockFree;
+        double a = run(locked, threads, ops);
+        double b = run(lockFree, threads, ops);
+        std::cout << std::setw(7) << threads << std::fixed << std::setprecision(2)
+                  << std::setw(23) << a / 1e6 << std::setw(25) << b / 1e6 << std::endl;
+    }
+    return 0;
+}
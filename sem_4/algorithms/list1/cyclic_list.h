@@ -0,0 +1,234 @@
+#ifndef CYCLIC_LIST_H
+#define CYCLIC_LIST_H
+
+#include <iostream>
+#include <new>
+#include <utility>
+
+#include "node_blocks.h"
+#include "reorganize_policy.h"
+
+class CyclicNode {
+public:
+    int data;
+    int hits;
+    CyclicNode* next;
+    CyclicNode(int val) : data(val), hits(0), next(nullptr) {}
+};
+
+class CyclicList {
+public:
+    CyclicNode* head;
+    int size;
+    ReorganizePolicy policy;
+    // Bumped whenever nodes are added, freed or relinked (insert, merge, compact, sort and
+    // reorganizing searches), so views holding node pointers can tell they are stale.
+    unsigned long modifications;
+
+    CyclicList(ReorganizePolicy policy = ReorganizePolicy::STATIC)
+        : head(nullptr), size(0), policy(policy), modifications(0) {}
+    
+    void insert(int value) {
+        CyclicNode* newNode = new CyclicNode(value);
+        if (!head) {
+            head = newNode;
+            newNode->next = newNode;
+        } else {
+            newNode->next = head->next;
+            head->next = newNode;
+        }
+        size++;
+        modifications++;
+    }
+
+    void merge(CyclicList& list2) {
+        if (!list2.head) {
+            return;
+        }
+
+        if (!head) {
+            head = list2.head;
+        } else {
+            CyclicNode* tmp = head->next;
+            head->next = list2.head->next;
+            list2.head->next = tmp;
+        }
+        
+        size += list2.size;
+        list2.head = nullptr;
+        list2.size = 0;
+        blocks.absorb(list2.blocks);
+        modifications++;
+        list2.modifications++;
+    }
+
+    int search(int value) {
+        if (!head) {
+            return 0;
+        }
+        int comparisons = 0;
+        CyclicNode* current = head;
+        CyclicNode* previous = nullptr;
+        do {
+            comparisons++;
+            if (current->data == value){
+                reorganize(current, previous);
+                return comparisons;
+            }
+            previous = current;
+            current = current->next;
+        } while (current != head);
+        return comparisons;
+    }
+
+    void print() {
+        if (!head) {
+            std::cout << "List is empty\n";
+            return;
+        }
+        CyclicNode* tmp = head;
+        do {
+            std::cout << tmp->data << " ";
+            tmp = tmp->next;
+        } while (tmp != head);
+        std::cout << std::endl;
+    }
+
+    // Moves every node into one freshly allocated array, in traversal order, so that a walk
+    // along the ring reads memory sequentially. Pointers to the old nodes become invalid.
+    void compact() {
+        if (!head) {
+            return;
+        }
+        CyclicNode* block = blocks.allocate(size);
+        CyclicNode* current = head;
+        for (int i = 0; i < size; i++) {
+            CyclicNode* copy = new (&block[i]) CyclicNode(current->data);
+            copy->hits = current->hits;
+            copy->next = i + 1 < size ? &block[i + 1] : block;
+            CyclicNode* old = current;
+            current = current->next;
+            if (!blocks.owns(old)) {
+                delete old;
+            }
+        }
+        blocks.release_except(block);
+        head = block;
+        modifications++;
+    }
+
+    // Stable bottom-up merge sort that relinks the nodes; the ring then starts at the
+    // minimum. bins[i] holds a sorted run of 2^i nodes, as in a binary counter, so the
+    // only extra memory is the fixed array of bins.
+    void sort() {
+        if (size < 2) {
+            return;
+        }
+        CyclicNode* tail = head;
+        while (tail->next != head) {
+            tail = tail->next;
+        }
+        tail->next = nullptr;
+
+        CyclicNode* bins[64] = {};
+        CyclicNode* current = head;
+        while (current) {
+            CyclicNode* run = current;
+            current = current->next;
+            run->next = nullptr;
+            int i = 0;
+            for (; bins[i]; i++) {
+                run = mergeRuns(bins[i], run);
+                bins[i] = nullptr;
+            }
+            bins[i] = run;
+        }
+        CyclicNode* sorted = nullptr;
+        for (CyclicNode* bin : bins) {
+            if (bin) {
+                sorted = mergeRuns(bin, sorted);
+            }
+        }
+
+        head = sorted;
+        tail = sorted;
+        while (tail->next) {
+            tail = tail->next;
+        }
+        tail->next = head;
+        modifications++;
+    }
+
+private:
+    NodeBlocks<CyclicNode> blocks;
+
+    // Merges two nullptr-terminated sorted runs; a holds the earlier nodes, so ties take a.
+    static CyclicNode* mergeRuns(CyclicNode* a, CyclicNode* b) {
+        CyclicNode dummy(0);
+        CyclicNode* tail = &dummy;
+        while (a && b) {
+            if (b->data < a->data) {
+                tail->next = b;
+                b = b->next;
+            } else {
+                tail->next = a;
+                a = a->next;
+            }
+            tail = tail->next;
+        }
+        tail->next = a ? a : b;
+        return dummy.next;
+    }
+
+    // Moves node (whose predecessor on the search path is previous, nullptr for head) so it
+    // sits right before target (targetPrevious likewise). There is no tail pointer, so
+    // putting a node before head is done by linking it in after head and swapping the
+    // two nodes' contents.
+    void moveBefore(CyclicNode* node, CyclicNode* previous, CyclicNode* target, CyclicNode* targetPrevious) {
+        if (node == target) {
+            return;
+        }
+        modifications++;
+        previous->next = node->next;
+        if (target == head) {
+            node->next = head->next;
+            head->next = node;
+            std::swap(head->data, node->data);
+            std::swap(head->hits, node->hits);
+        } else {
+            node->next = target;
+            targetPrevious->next = node;
+        }
+    }
+
+    void reorganize(CyclicNode* node, CyclicNode* previous) {
+        node->hits++;
+        switch (policy) {
+            case ReorganizePolicy::STATIC:
+                break;
+            case ReorganizePolicy::MOVE_TO_FRONT:
+                moveBefore(node, previous, head, nullptr);
+                break;
+            case ReorganizePolicy::TRANSPOSE:
+                if (previous) {
+                    std::swap(previous->data, node->data);
+                    std::swap(previous->hits, node->hits);
+                }
+                break;
+            case ReorganizePolicy::COUNT: {
+                // The list is kept in non-increasing hit order, so the new place is before
+                // the first node with fewer hits; it lies on the path already searched.
+                CyclicNode* target = head;
+                CyclicNode* targetPrevious = nullptr;
+                while (target != node && target->hits >= node->hits) {
+                    targetPrevious = target;
+                    target = target->next;
+                }
+                moveBefore(node, previous, target, targetPrevious);
+                break;
+            }
+        }
+    }
+};
+
+#endif // CYCLIC_LIST_H
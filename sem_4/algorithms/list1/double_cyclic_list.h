@@ -0,0 +1,304 @@
+#ifndef DOUBLE_CYCLIC_LIST_H
+#define DOUBLE_CYCLIC_LIST_H
+
+#include <iostream>
+#include <new>
+#include <random>
+#include <utility>
+
+#include "node_blocks.h"
+#include "reorganize_policy.h"
+
+class DoubleNode {
+public:
+    int data;
+    int hits;
+    DoubleNode* next;
+    DoubleNode* prev;
+    DoubleNode(int val) : data(val), hits(0), next(nullptr), prev(nullptr) {}
+};
+
+class DoubleCyclicList {
+public:
+    DoubleNode* head;
+    int size;
+    ReorganizePolicy policy;
+    // Bumped whenever nodes are added, freed or relinked (insert, merge, compact, sort and
+    // reorganizing searches), so views holding node pointers can tell they are stale.
+    unsigned long modifications;
+
+    DoubleCyclicList(ReorganizePolicy policy = ReorganizePolicy::STATIC)
+        : head(nullptr), size(0), policy(policy), modifications(0), oldHeadAfter(false) {}
+
+    void insert(int value) {
+        DoubleNode* newNode = new DoubleNode(value);
+        if (!head) {
+            head = newNode;
+            newNode->next = newNode;
+            newNode->prev = newNode;
+        } else {
+            DoubleNode* tail = head->prev;
+            tail->next = newNode;
+            newNode->prev = tail;
+            newNode->next = head;
+            head->prev = newNode;
+        }
+        size++;
+        modifications++;
+    }
+    
+    void merge(DoubleCyclicList& list2) {
+            if (!list2.head) {
+                return;
+            }
+    
+            if (!head) {
+                head = list2.head;
+            } else {
+                DoubleNode* tail1 = head->prev;
+                DoubleNode* tail2 = list2.head->prev;
+    
+                tail1->next = list2.head;
+                list2.head->prev = tail1;
+            
+                tail2->next = head;
+                head->prev = tail2;
+            }
+            
+            size += list2.size;
+            list2.head = nullptr;
+            list2.size = 0;
+            blocks.absorb(list2.blocks);
+            modifications++;
+            list2.modifications++;
+        }
+    
+    // Under STATIC the walk goes one way round, in a random direction. The reorganizing
+    // policies pull hot nodes towards head on both sides, which a random direction would
+    // undo (a node d steps away costs d or n - d, n / 2 on average), so their searches walk
+    // outward from head in both directions in turn.
+    int search(int value, std::mt19937& rng) {
+        if (!head) {
+            return 0;
+        }
+        if (policy != ReorganizePolicy::STATIC) {
+            return searchOutward(value);
+        }
+        int comparisons = 0;
+        DoubleNode* current = head;
+        std::uniform_int_distribution<int> dist(0, 1);
+        bool forward = dist(rng);
+        do {
+            comparisons++;
+            if (current->data == value) {
+                reorganize(current, forward);
+                return comparisons;
+            }
+            if (forward) {
+                current = current->next;
+            } else {
+                current = current->prev;
+            }
+        } while (current != head);
+        return comparisons;
+    }
+
+    void print() {
+        if (!head) {
+            std::cout << "List is empty\n";
+            return;
+        }
+        DoubleNode* tmp = head;
+        do {
+            std::cout << tmp->data << " ";
+            tmp = tmp->next;
+        } while (tmp != head);
+        std::cout << std::endl;
+    }
+
+    // Moves every node into one freshly allocated array, in traversal (next) order, so a walk
+    // in either direction reads memory sequentially. Pointers to the old nodes become invalid.
+    void compact() {
+        if (!head) {
+            return;
+        }
+        DoubleNode* block = blocks.allocate(size);
+        DoubleNode* current = head;
+        for (int i = 0; i < size; i++) {
+            DoubleNode* copy = new (&block[i]) DoubleNode(current->data);
+            copy->hits = current->hits;
+            copy->next = i + 1 < size ? &block[i + 1] : block;
+            copy->prev = i > 0 ? &block[i - 1] : &block[size - 1];
+            DoubleNode* old = current;
+            current = current->next;
+            if (!blocks.owns(old)) {
+                delete old;
+            }
+        }
+        blocks.release_except(block);
+        head = block;
+        modifications++;
+    }
+
+    // Stable bottom-up merge sort on the next links (see CyclicList::sort); the prev links
+    // are restored in one pass at the end. The ring then starts at the minimum.
+    void sort() {
+        if (size < 2) {
+            return;
+        }
+        head->prev->next = nullptr;
+
+        DoubleNode* bins[64] = {};
+        DoubleNode* current = head;
+        while (current) {
+            DoubleNode* run = current;
+            current = current->next;
+            run->next = nullptr;
+            int i = 0;
+            for (; bins[i]; i++) {
+                run = mergeRuns(bins[i], run);
+                bins[i] = nullptr;
+            }
+            bins[i] = run;
+        }
+        DoubleNode* sorted = nullptr;
+        for (DoubleNode* bin : bins) {
+            if (bin) {
+                sorted = mergeRuns(bin, sorted);
+            }
+        }
+
+        head = sorted;
+        DoubleNode* tail = sorted;
+        while (tail->next) {
+            tail->next->prev = tail;
+            tail = tail->next;
+        }
+        tail->next = head;
+        head->prev = tail;
+        modifications++;
+    }
+
+private:
+    NodeBlocks<DoubleNode> blocks;
+    // Side of the new head that move-to-front puts the old head on; it alternates.
+    bool oldHeadAfter;
+
+    // head, head->next, head->prev, head->next->next, ...; each node is examined once.
+    int searchOutward(int value) {
+        int comparisons = 1;
+        if (head->data == value) {
+            reorganize(head, true);
+            return comparisons;
+        }
+        DoubleNode* ahead = head->next;
+        DoubleNode* behind = head->prev;
+        for (int visited = 1; visited < size;) {
+            comparisons++;
+            visited++;
+            if (ahead->data == value) {
+                reorganize(ahead, true);
+                return comparisons;
+            }
+            ahead = ahead->next;
+            if (visited == size) {
+                break;
+            }
+            comparisons++;
+            visited++;
+            if (behind->data == value) {
+                reorganize(behind, false);
+                return comparisons;
+            }
+            behind = behind->prev;
+        }
+        return comparisons;
+    }
+
+    static DoubleNode* mergeRuns(DoubleNode* a, DoubleNode* b) {
+        DoubleNode dummy(0);
+        DoubleNode* tail = &dummy;
+        while (a && b) {
+            if (b->data < a->data) {
+                tail->next = b;
+                b = b->next;
+            } else {
+                tail->next = a;
+                a = a->next;
+            }
+            tail = tail->next;
+        }
+        tail->next = a ? a : b;
+        return dummy.next;
+    }
+
+    void unlink(DoubleNode* node) {
+        modifications++;
+        node->prev->next = node->next;
+        node->next->prev = node->prev;
+    }
+
+    void linkBetween(DoubleNode* a, DoubleNode* b, DoubleNode* node) {
+        a->next = node;
+        node->prev = a;
+        node->next = b;
+        b->prev = node;
+    }
+
+    // forward tells on which side of head the search reached node: along next or along prev.
+    // "Towards the front" means prev for the first and next for the second; COUNT keeps each
+    // side in non-increasing hit order going away from head.
+    void reorganize(DoubleNode* node, bool forward) {
+        node->hits++;
+        if (node == head) {
+            return;
+        }
+        switch (policy) {
+            case ReorganizePolicy::STATIC:
+                break;
+            case ReorganizePolicy::MOVE_TO_FRONT:
+                // Alternating the old head's side keeps the recently found nodes spread
+                // over both sides of head, where the outward search reaches them first.
+                unlink(node);
+                if (oldHeadAfter) {
+                    linkBetween(head->prev, head, node);
+                } else {
+                    linkBetween(head, head->next, node);
+                }
+                oldHeadAfter = !oldHeadAfter;
+                head = node;
+                break;
+            case ReorganizePolicy::TRANSPOSE: {
+                DoubleNode* before = forward ? node->prev : node->next;
+                std::swap(before->data, node->data);
+                std::swap(before->hits, node->hits);
+                break;
+            }
+            case ReorganizePolicy::COUNT: {
+                DoubleNode* target = node;
+                while (target != head) {
+                    DoubleNode* before = forward ? target->prev : target->next;
+                    if (before->hits >= node->hits) {
+                        break;
+                    }
+                    target = before;
+                }
+                if (target == node) {
+                    break;
+                }
+                unlink(node);
+                if (forward) {
+                    linkBetween(target->prev, target, node);
+                } else {
+                    linkBetween(target, target->next, node);
+                }
+                if (target == head) {
+                    head = node;
+                }
+                break;
+            }
+        }
+    }
+};
+
+#endif // DOUBLE_CYCLIC_LIST_H
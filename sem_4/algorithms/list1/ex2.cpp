@@ -1,75 +1,7 @@
 #include <iostream>
 #include <random>
 
-class Node {
-public:
-    int data;
-    Node* next;
-    Node(int val) : data(val), next(nullptr) {}
-};
-
-class CyclicList {
-public:
-    Node* head;
-    int size;
-
-    CyclicList() : head(nullptr), size(0) {}
-    
-    void insert(int value) {
-        Node* newNode = new Node(value);
-        if (!head) {
-            head = newNode;
-            newNode->next = newNode;
-        } else {
-            newNode->next = head->next;
-            head->next = newNode;
-        }
-        size++;
-    }
-
-    void merge(CyclicList& list2) {
-        if (!list2.head) {
-            return;
-        }
-
-        Node* tmp = head->next;
-        head->next = list2.head->next;
-        list2.head->next = tmp;
-        
-        size += list2.size;
-        list2.head = nullptr;
-        list2.size = 0;
-    }
-
-    int search(int value) {
-        if (!head) {
-            return 0;
-        }
-        int comparisons = 0;
-        Node* current = head;
-        do {
-            comparisons++;
-            if (current->data == value){
-                return comparisons;
-            }
-            current = current->next;
-        } while (current != head);
-        return comparisons;
-    }
-
-    void print() {
-        if (!head) {
-            std::cout << "List is empty\n";
-            return;
-        }
-        Node* tmp = head;
-        do {
-            std::cout << tmp->data << " ";
-            tmp = tmp->next;
-        } while (tmp != head);
-        std::cout << std::endl;
-    }
-};
+#include "cyclic_list.h"
 
 int main() {
     std::random_device rd;
@@ -1,91 +1,7 @@
 #include <iostream>
 #include <random>
 
-class Node {
-public:
-    int data;
-    Node* next;
-    Node* prev;
-    Node(int val) : data(val), next(nullptr), prev(nullptr) {}
-};
-
-class DoubleCyclicList {
-public:
-    Node* head;
-    int size;
-
-    DoubleCyclicList() : head(nullptr), size(0) {}
-
-    void insert(int value) {
-        Node* newNode = new Node(value);
-        if (!head) {
-            head = newNode;
-            newNode->next = newNode;
-            newNode->prev = newNode;
-        } else {
-            Node* tail = head->prev;
-            tail->next = newNode;
-            newNode->prev = tail;
-            newNode->next = head;
-            head->prev = newNode;
-        }
-        size++;
-    }
-    
-    void merge(DoubleCyclicList& list2) {
-            if (!list2.head) {
-                return;
-            }
-    
-            Node* tail1 = head->prev;
-            Node* tail2 = list2.head->prev;
-    
-            tail1->next = list2.head;
-            list2.head->prev = tail1;
-            
-            tail2->next = head;
-            head->prev = tail2;
-            
-            size += list2.size;
-            list2.head = nullptr;
-            list2.size = 0;
-        }
-    
-    int search(int value, std::mt19937& rng) {
-        if (!head) {
-            return 0;
-        }
-        int comparisons = 0;
-        Node* current = head;
-        std::uniform_int_distribution<int> dist(0, 1);
-        bool forward = dist(rng);
-        do {
-            comparisons++;
-            if (current->data == value) {
-                return comparisons;
-            }
-            if (forward) {
-                current = current->next;
-            } else {
-                current = current->prev;
-            }
-        } while (current != head);
-        return comparisons;
-    }
-
-    void print() {
-        if (!head) {
-            std::cout << "List is empty\n";
-            return;
-        }
-        Node* tmp = head;
-        do {
-            std::cout << tmp->data << " ";
-            tmp = tmp->next;
-        } while (tmp != head);
-        std::cout << std::endl;
-    }
-};
+#include "double_cyclic_list.h"
 
 int main() {
     std::random_device rd;
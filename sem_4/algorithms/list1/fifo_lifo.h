@@ -0,0 +1,77 @@
+#ifndef FIFO_LIFO_H
+#define FIFO_LIFO_H
+
+#include <iostream>
+
+class Node {
+public:
+    int data;
+    Node* next;
+    Node(int val) : data(val), next(nullptr) {}
+};
+
+class FIFO {
+private:
+    Node* head;
+    Node* tail;
+    bool verbose;
+public:
+    FIFO(bool verbose = false) : head(nullptr), tail(nullptr), verbose(verbose) {}
+    
+    void push(int item) {
+        Node* newNode = new Node(item);
+        if (!tail) {
+            head = tail = newNode;
+        } else {
+            tail->next = newNode;
+            tail = newNode;
+        }
+        if (verbose) std::cout << item << " ";
+    }
+    
+    void pop() {
+        if (!head) {
+            if (verbose) std::cout << "FIFO is empty!" << std::endl;
+            return;
+        }
+        Node* tmp = head;
+        head = head->next;
+        if (!head) {
+            tail = nullptr;
+        }
+        if (verbose) std::cout << tmp->data << " ";
+        delete tmp;
+    }
+
+    bool empty() const { return head == nullptr; }
+};
+
+class LIFO {
+private:
+    Node* top;
+    bool verbose;
+public:
+    LIFO(bool verbose = false) : top(nullptr), verbose(verbose) {}
+    
+    void push(int item) {
+        Node* newNode = new Node(item);
+        newNode->next = top;
+        top = newNode;
+        if (verbose) std::cout << item << " ";
+    }
+    
+    void pop() {
+        if (!top) {
+            if (verbose) std::cout << "LIFO is empty!" << std::endl;
+            return;
+        }
+        Node* tmp = top;
+        top = top->next;
+        if (verbose) std::cout << tmp->data << " ";
+        delete tmp;
+    }
+
+    bool empty() const { return top == nullptr; }
+};
+
+#endif // FIFO_LIFO_H
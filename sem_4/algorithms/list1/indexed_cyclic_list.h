@@ -0,0 +1,162 @@
+#ifndef INDEXED_CYCLIC_LIST_H
+#define INDEXED_CYCLIC_LIST_H
+
+#include <cstdint>
+#include <vector>
+#include <utility>
+
+#include "cyclic_list.h"
+
+// Open-addressing hash index from key to the first ring node holding it. Probes are
+// counted so lookups can be reported in the same units as CyclicList::search.
+class NodeIndex {
+private:
+    struct Slot {
+        int key;
+        CyclicNode* node;
+    };
+
+    std::vector<Slot> slots;
+    std::size_t mask;
+    std::size_t used;
+
+    static std::size_t hash(int key) {
+        std::uint64_t h = static_cast<std::uint32_t>(key) * 0x9E3779B97F4A7C15ULL;
+        return static_cast<std::size_t>(h >> 32);
+    }
+
+    void rehash(std::size_t capacity) {
+        std::vector<Slot> old(capacity, Slot{0, nullptr});
+        old.swap(slots);
+        mask = capacity - 1;
+        used = 0;
+        for (const Slot& s : old) {
+            if (s.node) {
+                add(s.key, s.node);
+            }
+        }
+    }
+
+public:
+    NodeIndex() : slots(16, Slot{0, nullptr}), mask(15), used(0) {}
+
+    std::size_t size() const { return used; }
+
+    // Keeps the first node inserted for a key; later duplicates are reachable through it.
+    void add(int key, CyclicNode* node) {
+        if ((used + 1) * 4 > slots.size() * 3) {
+            rehash(slots.size() * 2);
+        }
+        std::size_t i = hash(key) & mask;
+        while (slots[i].node) {
+            if (slots[i].key == key) {
+                return;
+            }
+            i = (i + 1) & mask;
+        }
+        slots[i] = Slot{key, node};
+        used++;
+    }
+
+    // Counts every slot probed, including the empty one that ends a miss.
+    CyclicNode* find(int key, int& comparisons) const {
+        std::size_t i = hash(key) & mask;
+        while (true) {
+            comparisons++;
+            if (!slots[i].node) {
+                return nullptr;
+            }
+            if (slots[i].key == key) {
+                return slots[i].node;
+            }
+            i = (i + 1) & mask;
+        }
+    }
+
+    // Moves every entry of the smaller index into the larger one and leaves the result in
+    // *this, so each key is re-inserted O(log n) times over any sequence of merges.
+    void absorb(NodeIndex& other) {
+        if (other.used > used) {
+            std::swap(slots, other.slots);
+            std::swap(mask, other.mask);
+            std::swap(used, other.used);
+        }
+        for (const Slot& s : other.slots) {
+            if (s.node) {
+                add(s.key, s.node);
+            }
+        }
+        other = NodeIndex();
+    }
+};
+
+// CyclicList with an optional hash index over its nodes. With the index enabled search()
+// costs O(1) expected probes; without it it is the plain linear walk.
+class IndexedCyclicList {
+public:
+    CyclicList list;
+    NodeIndex index;
+    bool useIndex;
+
+    IndexedCyclicList(bool useIndex = true) : useIndex(useIndex) {}
+
+    int size() const { return list.size; }
+
+    void insert(int value) {
+        list.insert(value);
+        if (useIndex) {
+            CyclicNode* node = list.head->next == list.head ? list.head : list.head->next;
+            index.add(value, node);
+        }
+    }
+
+    // The ring splice stays O(1); the index merge is smaller-into-larger. Merging an
+    // indexed list with an unindexed one drops the index.
+    void merge(IndexedCyclicList& list2) {
+        if (!list2.list.head) {
+            return;
+        }
+        list.merge(list2.list);
+        if (useIndex && list2.useIndex) {
+            index.absorb(list2.index);
+        } else {
+            useIndex = false;
+            index = NodeIndex();
+        }
+        list2.index = NodeIndex();
+    }
+
+    // Returns the number of key comparisons: hash probes when indexed, nodes visited otherwise.
+    int search(int value) {
+        if (!useIndex) {
+            return list.search(value);
+        }
+        int comparisons = 0;
+        index.find(value, comparisons);
+        return comparisons;
+    }
+
+    bool contains(int value) {
+        if (!useIndex) {
+            CyclicNode* current = list.head;
+            if (!current) {
+                return false;
+            }
+            do {
+                if (current->data == value) {
+                    return true;
+                }
+                current = current->next;
+            } while (current != list.head);
+            return false;
+        }
+        int comparisons = 0;
+        return index.find(value, comparisons) != nullptr;
+    }
+
+    void print() {
+        list.print();
+    }
+};
+
+#endif // INDEXED_CYCLIC_LIST_H
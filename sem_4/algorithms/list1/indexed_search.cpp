@@ -0,0 +1,88 @@
+#include <iostream>
+#include <random>
+#include <vector>
+#include <chrono>
+
+#include "indexed_cyclic_list.h"
+#include "bench_util.h"
+
+int main(int argc, char* argv[]) {
+    int n = argc >= 2 ? std::stoi(argv[1]) : 10000;
+    int queries = argc >= 3 ? std::stoi(argv[2]) : 1000;
+
+    std::random_device rd;
+    std::mt19937 rng(rd());
+    std::uniform_int_distribution<int> dist1(10, 99);
+    std::uniform_int_distribution<int> dist2(0, 100000);
+    std::uniform_int_distribution<int> index_dist(0, n - 1);
+
+    IndexedCyclicList list1, list2;
+    for (int i = 0; i < 10; i++) {
+        list1.insert(dist1(rng));
+        list2.insert(dist1(rng));
+    }
+
+    std::cout << "List 1: ";
+    list1.print();
+
+    std::cout << "List 2: ";
+    list2.print();
+
+    list1.merge(list2);
+    std::cout << "Merged list: ";
+    list1.print();
+    std::cout << "Contains " << list1.list.head->data << ": " << list1.contains(list1.list.head->data) << std::endl;
+
+    // Build both lists out of 100-element pieces so the index goes through many merges.
+    std::vector<int> T(n);
+    for (int i = 0; i < n; i++) {
+        T[i] = dist2(rng);
+    }
+
+    IndexedCyclicList linear(false), indexed(true);
+    double linearBuildMs = 0, indexedBuildMs = 0;
+    for (int useIndex = 0; useIndex < 2; useIndex++) {
+        IndexedCyclicList& target = useIndex ? indexed : linear;
+        auto start = std::chrono::steady_clock::now();
+        for (int i = 0; i < n; i += 100) {
+            IndexedCyclicList piece(useIndex);
+            for (int j = i; j < n && j < i + 100; j++) {
+                piece.insert(T[j]);
+            }
+            target.merge(piece);
+        }
+        (useIndex ? indexedBuildMs : linearBuildMs) = elapsed_ms(start);
+    }
+    std::cout << "Build by merging 100-element lists: linear " << linearBuildMs
+              << " ms, indexed " << indexedBuildMs << " ms" << std::endl;
+
+    std::vector<int> fromList(queries), randomValues(queries);
+    for (int i = 0; i < queries; i++) {
+        fromList[i] = T[index_dist(rng)];
+        randomValues[i] = dist2(rng);
+    }
+
+    for (int pass = 0; pass < 2; pass++) {
+        const std::vector<int>& keys = pass == 0 ? fromList : randomValues;
+        const char* label = pass == 0 ? "elements from the list" : "random elements";
+
+        long long linearComparisons = 0, indexedComparisons = 0;
+        auto start = std::chrono::steady_clock::now();
+        for (int key : keys) {
+            linearComparisons += linear.search(key);
+        }
+        double linearMs = elapsed_ms(start);
+
+        start = std::chrono::steady_clock::now();
+        for (int key : keys) {
+            indexedComparisons += indexed.search(key);
+        }
+        double indexedMs = elapsed_ms(start);
+
+        std::cout << "Average cost (" << label << "): linear " << linearComparisons / double(queries)
+                  << ", indexed " << indexedComparisons / double(queries) << std::endl;
+        std::cout << "  time: linear " << linearMs << " ms, indexed " << indexedMs << " ms" << std::endl;
+    }
+
+    return 0;
+}
@@ -0,0 +1,155 @@
+#include <iostream>
+#include <iomanip>
+#include <string>
+#include <vector>
+#include <queue>
+#include <stack>
+#include <deque>
+#include <algorithm>
+#include <chrono>
+#include <functional>
+#include <random>
+#include <cstdint>
+#include <sys/resource.h>
+
+#include "fifo_lifo.h"
+#include "cyclic_list.h"
+#include "double_cyclic_list.h"
+#include "bench_util.h"
+
+// Usage: ./list1_bench [ops] [searches]
+// Every container runs in its own process so peak RSS (ru_maxrss) belongs to that run only.
+//
+//   queue: 60% push / 40% pop          FIFO vs std::queue vs std::deque
+//   stack: 60% push / 40% pop          LIFO vs std::stack vs std::deque
+//   list:  inserts, plus every 64th op merges in a 16-element list built on the side,
+//          then `searches` lookups of absent keys (each walks the whole list)
+//                                      CyclicList, DoubleCyclicList vs std::deque
+
+struct XorShift {
+    std::uint64_t state = 88172645463325252ULL;
+    std::uint64_t operator()() {
+        state ^= state << 13;
+        state ^= state >> 7;
+        state ^= state << 17;
+        return state;
+    }
+};
+
+void report(const std::string& workload, const std::string& name, long long ops, double seconds) {
+    struct rusage usage;
+    getrusage(RUSAGE_SELF, &usage);
+    std::cout << std::left << std::setw(8) << workload << std::setw(18) << name << std::right
+              << std::setw(12) << ops << std::fixed << std::setprecision(3) << std::setw(10) << seconds
+              << std::setprecision(2) << std::setw(10) << ops / seconds / 1e6
+              << std::setw(10) << seconds * 1e9 / ops
+              << std::setw(12) << usage.ru_maxrss / 1024.0 << std::endl;
+}
+
+template <typename Push, typename Pop>
+double push_pop_mix(long long ops, Push push, Pop pop) {
+    XorShift rng;
+    auto start = std::chrono::steady_clock::now();
+    for (long long i = 0; i < ops; i++) {
+        if (rng() % 10 < 6) {
+            push(static_cast<int>(i));
+        } else {
+            pop();
+        }
+    }
+    return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+}
+
+// Inserts and merges count as one op each (the 16 inserts into the side list included).
+// The searches are timed separately; their row counts one op per element compared.
+template <typename List, typename Search>
+void list_mix(const std::string& name, long long ops, int searches, Search search) {
+    List list;
+    auto start = std::chrono::steady_clock::now();
+    for (long long i = 0; i < ops;) {
+        if (i % 64 == 63) {
+            List side;
+            for (int j = 0; j < 16; j++) {
+                side.insert(static_cast<int>(i + j));
+            }
+            list.merge(side);
+            i += 17;
+        } else {
+            list.insert(static_cast<int>(i));
+            i++;
+        }
+    }
+    double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    report("list", name, ops, seconds);
+
+    start = std::chrono::steady_clock::now();
+    long long comparisons = 0;
+    for (int s = 0; s < searches; s++) {
+        comparisons += search(list, -1 - s);
+    }
+    seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    report("search", name, comparisons, seconds);
+}
+
+int main(int argc, char* argv[]) {
+    long long ops = argc >= 2 ? std::stoll(argv[1]) : 10000000;
+    int searches = argc >= 3 ? std::stoi(argv[2]) : 10;
+
+    std::cout << "Workload Container                 ops  time [s]    Mops/s     ns/op  peak RSS [MB]" << std::endl;
+
+    run_isolated([ops] {
+        FIFO q;
+        report("queue", "FIFO", ops, push_pop_mix(ops, [&](int x) { q.push(x); }, [&] { q.pop(); }));
+    });
+    run_isolated([ops] {
+        std::queue<int> q;
+        report("queue", "std::queue", ops, push_pop_mix(ops, [&](int x) { q.push(x); },
+                                                        [&] { if (!q.empty()) q.pop(); }));
+    });
+    run_isolated([ops] {
+        std::deque<int> q;
+        report("queue", "std::deque", ops, push_pop_mix(ops, [&](int x) { q.push_back(x); },
+                                                        [&] { if (!q.empty()) q.pop_front(); }));
+    });
+
+    run_isolated([ops] {
+        LIFO s;
+        report("stack", "LIFO", ops, push_pop_mix(ops, [&](int x) { s.push(x); }, [&] { s.pop(); }));
+    });
+    run_isolated([ops] {
+        std::stack<int> s;
+        report("stack", "std::stack", ops, push_pop_mix(ops, [&](int x) { s.push(x); },
+                                                        [&] { if (!s.empty()) s.pop(); }));
+    });
+    run_isolated([ops] {
+        std::deque<int> s;
+        report("stack", "std::deque", ops, push_pop_mix(ops, [&](int x) { s.push_back(x); },
+                                                        [&] { if (!s.empty()) s.pop_back(); }));
+    });
+
+    run_isolated([ops, searches] {
+        list_mix<CyclicList>("CyclicList", ops, searches,
+                             [](CyclicList& list, int key) { return list.search(key); });
+    });
+    run_isolated([ops, searches] {
+        std::mt19937 rng(1);
+        list_mix<DoubleCyclicList>("DoubleCyclicList", ops, searches,
+                                   [&](DoubleCyclicList& list, int key) { return list.search(key, rng); });
+    });
+    run_isolated([ops, searches] {
+        struct DequeList {
+            std::deque<int> items;
+            void insert(int x) { items.push_back(x); }
+            void merge(DequeList& other) {
+                items.insert(items.end(), other.items.begin(), other.items.end());
+                other.items.clear();
+            }
+        };
+        list_mix<DequeList>("std::deque", ops, searches, [](DequeList& list, int key) {
+            auto it = std::find(list.items.begin(), list.items.end(), key);
+            return static_cast<int>(it - list.items.begin());
+        });
+    });
+
+    return 0;
+}
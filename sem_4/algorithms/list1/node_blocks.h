@@ -0,0 +1,64 @@
+#ifndef NODE_BLOCKS_H
+#define NODE_BLOCKS_H
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <new>
+#include <vector>
+
+// Contiguous node storage for compact(). A list can hold both nodes it got from `new`
+// and nodes living inside a block; owns() tells them apart so compact() knows which old
+// nodes to delete one by one and which to drop together with their block.
+template <typename Node>
+class NodeBlocks {
+private:
+    struct Block {
+        std::uintptr_t begin;
+        std::uintptr_t end;
+    };
+    std::vector<Block> blocks;  // sorted by address
+
+public:
+    // Raw storage for count nodes; the caller constructs them with placement new.
+    Node* allocate(std::size_t count) {
+        Node* nodes = static_cast<Node*>(::operator new(count * sizeof(Node)));
+        std::uintptr_t begin = reinterpret_cast<std::uintptr_t>(nodes);
+        Block block{begin, begin + count * sizeof(Node)};
+        auto pos = std::lower_bound(blocks.begin(), blocks.end(), block,
+                                    [](const Block& a, const Block& b) { return a.begin < b.begin; });
+        blocks.insert(pos, block);
+        return nodes;
+    }
+
+    bool owns(const Node* node) const {
+        std::uintptr_t address = reinterpret_cast<std::uintptr_t>(node);
+        auto pos = std::upper_bound(blocks.begin(), blocks.end(), address,
+                                    [](std::uintptr_t a, const Block& b) { return a < b.begin; });
+        return pos != blocks.begin() && address < (pos - 1)->end;
+    }
+
+    // Frees every block except keep (nodes are trivially destructible).
+    void release_except(const Node* keep) {
+        std::vector<Block> kept;
+        for (const Block& block : blocks) {
+            if (block.begin == reinterpret_cast<std::uintptr_t>(keep)) {
+                kept.push_back(block);
+            } else {
+                ::operator delete(reinterpret_cast<void*>(block.begin));
+            }
+        }
+        blocks.swap(kept);
+    }
+
+    // Takes over the blocks of another list (used when lists are merged).
+    void absorb(NodeBlocks& other) {
+        std::vector<Block> combined(blocks.size() + other.blocks.size());
+        std::merge(blocks.begin(), blocks.end(), other.blocks.begin(), other.blocks.end(), combined.begin(),
+                   [](const Block& a, const Block& b) { return a.begin < b.begin; });
+        blocks.swap(combined);
+        other.blocks.clear();
+    }
+};
+
+#endif // NODE_BLOCKS_H
@@ -0,0 +1,67 @@
+#include <iostream>
+#include <iomanip>
+#include <random>
+#include <vector>
+#include <chrono>
+#include <thread>
+
+#include "double_cyclic_list.h"
+#include "parallel_search.h"
+
+// Usage: ./parallel_search [max_n] [threads] [queries]
+// Sizes go from 10^5 up to max_n in powers of ten; half the queries are list elements and
+// half are absent keys, which force a full scan.
+int main(int argc, char* argv[]) {
+    long long maxN = argc >= 2 ? std::stoll(argv[1]) : 10000000;
+    int threads = argc >= 3 ? std::stoi(argv[2]) : std::thread::hardware_concurrency();
+    int queries = argc >= 4 ? std::stoi(argv[3]) : 20;
+    if (threads < 2) {
+        threads = 2;
+    }
+
+    std::mt19937 rng(12345);
+    std::cout << "Threads for k-way search: " << threads << std::endl;
+    std::cout << std::setw(11) << "n" << std::setw(14) << "single [ms]" << std::setw(14) << "bidir [ms]"
+              << std::setw(10) << "speedup" << std::setw(14) << "k-way [ms]" << std::setw(10) << "speedup" << std::endl;
+
+    for (long long n = 100000; n <= maxN; n *= 10) {
+        DoubleCyclicList list;
+        std::uniform_int_distribution<int> values(0, 2 * n - 1);
+        std::vector<int> T(n);
+        for (long long i = 0; i < n; i++) {
+            T[i] = values(rng);
+            list.insert(T[i]);
+        }
+
+        std::vector<int> keys(queries);
+        std::uniform_int_distribution<long long> index_dist(0, n - 1);
+        for (int q = 0; q < queries; q++) {
+            keys[q] = q % 2 == 0 ? T[index_dist(rng)] : -1 - q;
+        }
+
+        ParallelListSearch searcher(list, threads);
+
+        auto t0 = std::chrono::steady_clock::now();
+        long long single = 0;
+        for (int key : keys) single += list.search(key, rng);
+        auto t1 = std::chrono::steady_clock::now();
+        long long bidir = 0;
+        for (int key : keys) bidir += searcher.bidirectional(key).comparisons;
+        auto t2 = std::chrono::steady_clock::now();
+        long long kway = 0;
+        for (int key : keys) kway += searcher.kway(key).comparisons;
+        auto t3 = std::chrono::steady_clock::now();
+
+        double singleMs = std::chrono::duration<double, std::milli>(t1 - t0).count() / queries;
+        double bidirMs = std::chrono::duration<double, std::milli>(t2 - t1).count() / queries;
+        double kwayMs = std::chrono::duration<double, std::milli>(t3 - t2).count() / queries;
+
+        std::cout << std::fixed << std::setprecision(3) << std::setw(11) << n << std::setw(14) << singleMs
+                  << std::setw(14) << bidirMs << std::setw(10) << singleMs / bidirMs
+                  << std::setw(14) << kwayMs << std::setw(10) << singleMs / kwayMs << std::endl;
+        std::cout << "    average comparisons: single " << single / double(queries)
+                  << ", bidir " << bidir / double(queries) << ", k-way " << kway / double(queries) << std::endl;
+    }
+
+    return 0;
+}
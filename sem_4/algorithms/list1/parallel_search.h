@@ -0,0 +1,182 @@
+#ifndef PARALLEL_SEARCH_H
+#define PARALLEL_SEARCH_H
+
+#include <atomic>
+#include <condition_variable>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "double_cyclic_list.h"
+
+// Fixed set of worker threads that run a batch of numbered tasks and block the caller
+// until all of them are done. Workers pick task indices from a shared counter, so a batch
+// may have more tasks than threads.
+class SearchPool {
+private:
+    std::vector<std::thread> workers;
+    std::mutex mtx;
+    std::condition_variable wake;
+    std::condition_variable finished;
+    std::function<void(int)> job;
+    std::atomic<int> nextTask;
+    int taskCount;
+    int running;
+    unsigned generation;
+    bool stop;
+
+    void worker_loop() {
+        unsigned seen = 0;
+        while (true) {
+            {
+                std::unique_lock<std::mutex> lock(mtx);
+                wake.wait(lock, [&] { return stop || generation != seen; });
+                if (stop) {
+                    return;
+                }
+                seen = generation;
+            }
+            int task;
+            while ((task = nextTask.fetch_add(1)) < taskCount) {
+                job(task);
+            }
+            std::lock_guard<std::mutex> lock(mtx);
+            if (--running == 0) {
+                finished.notify_one();
+            }
+        }
+    }
+
+public:
+    explicit SearchPool(int threads)
+        : nextTask(0), taskCount(0), running(0), generation(0), stop(false) {
+        for (int i = 0; i < threads; i++) {
+            workers.emplace_back(&SearchPool::worker_loop, this);
+        }
+    }
+
+    ~SearchPool() {
+        {
+            std::lock_guard<std::mutex> lock(mtx);
+            stop = true;
+        }
+        wake.notify_all();
+        for (auto& w : workers) {
+            w.join();
+        }
+    }
+
+    int size() const { return workers.size(); }
+
+    void run(int tasks, const std::function<void(int)>& f) {
+        std::unique_lock<std::mutex> lock(mtx);
+        job = f;
+        taskCount = tasks;
+        nextTask.store(0);
+        running = workers.size();
+        generation++;
+        wake.notify_all();
+        finished.wait(lock, [&] { return running == 0; });
+    }
+};
+
+struct ParallelSearchResult {
+    bool found;
+    long long comparisons;  // nodes examined by all threads together
+};
+
+// Parallel search strategies over a DoubleCyclicList that is not modified while searching.
+// The k-way segment boundaries point into the ring, so kway() rebuilds them whenever the
+// list's modifications counter has moved since the last refresh().
+class ParallelListSearch {
+private:
+    DoubleCyclicList& list;
+    SearchPool pool;
+    int segments;
+    std::vector<DoubleNode*> anchors;
+    std::vector<int> lengths;
+    unsigned long seen;
+
+public:
+    ParallelListSearch(DoubleCyclicList& list, int threads, int segmentsPerThread = 4)
+        : list(list), pool(threads < 2 ? 2 : threads),
+          segments((threads < 2 ? 2 : threads) * segmentsPerThread), seen(0) {
+        refresh();
+    }
+
+    void refresh() {
+        anchors.clear();
+        lengths.clear();
+        seen = list.modifications;
+        if (!list.head) {
+            return;
+        }
+        int n = list.size;
+        int count = n < segments ? n : segments;
+        DoubleNode* current = list.head;
+        for (int s = 0; s < count; s++) {
+            int length = n / count + (s < n % count ? 1 : 0);
+            anchors.push_back(current);
+            lengths.push_back(length);
+            for (int i = 0; i < length; i++) {
+                current = current->next;
+            }
+        }
+    }
+
+    // One thread walks forward from head, the other backward from head->prev. Each covers
+    // its half of the ring and both stop as soon as either one finds the value.
+    ParallelSearchResult bidirectional(int value) {
+        if (!list.head) {
+            return {false, 0};
+        }
+        std::atomic<bool> found(false);
+        std::atomic<long long> comparisons(0);
+        int n = list.size;
+        int forwardLength = (n + 1) / 2;
+
+        pool.run(2, [&](int task) {
+            bool forward = task == 0;
+            DoubleNode* current = forward ? list.head : list.head->prev;
+            int length = forward ? forwardLength : n - forwardLength;
+            long long local = 0;
+            for (int i = 0; i < length && !found.load(std::memory_order_relaxed); i++) {
+                local++;
+                if (current->data == value) {
+                    found.store(true, std::memory_order_relaxed);
+                    break;
+                }
+                current = forward ? current->next : current->prev;
+            }
+            comparisons.fetch_add(local, std::memory_order_relaxed);
+        });
+        return {found.load(), comparisons.load()};
+    }
+
+    // Segments of the ring are handed out to the pool; a hit in any segment cancels the rest.
+    ParallelSearchResult kway(int value) {
+        if (list.modifications != seen) {
+            refresh();
+        }
+        std::atomic<bool> found(false);
+        std::atomic<long long> comparisons(0);
+
+        pool.run(anchors.size(), [&](int task) {
+            DoubleNode* current = anchors[task];
+            long long local = 0;
+            for (int i = 0; i < lengths[task] && !found.load(std::memory_order_relaxed); i++) {
+                local++;
+                if (current->data == value) {
+                    found.store(true, std::memory_order_relaxed);
+                    break;
+                }
+                current = current->next;
+            }
+            comparisons.fetch_add(local, std::memory_order_relaxed);
+        });
+        return {found.load(), comparisons.load()};
+    }
+};
+
+#endif // PARALLEL_SEARCH_H
@@ -0,0 +1,22 @@
+#ifndef REORGANIZE_POLICY_H
+#define REORGANIZE_POLICY_H
+
+// What a list does with a node after a successful search.
+enum class ReorganizePolicy {
+    STATIC,         // leave the list as it is
+    MOVE_TO_FRONT,  // make the found node the new head
+    TRANSPOSE,      // swap the found node with the one visited just before it
+    COUNT           // keep nodes ordered by number of hits, most frequent first
+};
+
+inline const char* policy_name(ReorganizePolicy policy) {
+    switch (policy) {
+        case ReorganizePolicy::STATIC: return "static";
+        case ReorganizePolicy::MOVE_TO_FRONT: return "move-to-front";
+        case ReorganizePolicy::TRANSPOSE: return "transpose";
+        case ReorganizePolicy::COUNT: return "count";
+    }
+    return "unknown";
+}
+
+#endif // REORGANIZE_POLICY_H
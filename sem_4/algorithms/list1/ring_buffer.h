@@ -0,0 +1,232 @@
+#ifndef RING_BUFFER_H
+#define RING_BUFFER_H
+
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <thread>
+
+// Bounded FIFO queues on a preallocated circular array. push/pop never allocate,
+// push returns false when the buffer is full and pop returns false when it is empty.
+
+constexpr std::size_t CACHE_LINE = 64;
+
+inline std::size_t round_up_to_power_of_two(std::size_t n) {
+    std::size_t capacity = 1;
+    while (capacity < n) {
+        capacity <<= 1;
+    }
+    return capacity;
+}
+
+// Single producer / single consumer. Each side owns one index and only reads the other,
+// keeping a cached copy of it so the shared cache line is touched only when the cached
+// value says the buffer looks full (producer) or empty (consumer).
+template <typename T>
+class SPSCRingBuffer {
+private:
+    const std::size_t capacity;
+    const std::size_t mask;
+    std::unique_ptr<T[]> buffer;
+
+    alignas(CACHE_LINE) std::atomic<std::size_t> head;
+    std::size_t cachedTail;
+    alignas(CACHE_LINE) std::atomic<std::size_t> tail;
+    std::size_t cachedHead;
+
+public:
+    explicit SPSCRingBuffer(std::size_t minCapacity)
+        : capacity(round_up_to_power_of_two(minCapacity)), mask(capacity - 1),
+          buffer(new T[capacity]), head(0), cachedTail(0), tail(0), cachedHead(0) {}
+
+    SPSCRingBuffer(const SPSCRingBuffer&) = delete;
+    SPSCRingBuffer& operator=(const SPSCRingBuffer&) = delete;
+
+    bool push(const T& item) {
+        return push_n(&item, 1) == 1;
+    }
+
+    bool pop(T& item) {
+        return pop_n(&item, 1) == 1;
+    }
+
+    // Pushes up to count items and publishes them with a single release store.
+    std::size_t push_n(const T* items, std::size_t count) {
+        std::size_t t = tail.load(std::memory_order_relaxed);
+        if (capacity - (t - cachedHead) < count) {
+            cachedHead = head.load(std::memory_order_acquire);
+        }
+        std::size_t free = capacity - (t - cachedHead);
+        if (count > free) {
+            count = free;
+        }
+        for (std::size_t i = 0; i < count; i++) {
+            buffer[(t + i) & mask] = items[i];
+        }
+        tail.store(t + count, std::memory_order_release);
+        return count;
+    }
+
+    // Pops up to count items and releases their slots with a single release store.
+    std::size_t pop_n(T* items, std::size_t count) {
+        std::size_t h = head.load(std::memory_order_relaxed);
+        if (cachedTail - h < count) {
+            cachedTail = tail.load(std::memory_order_acquire);
+        }
+        std::size_t available = cachedTail - h;
+        if (count > available) {
+            count = available;
+        }
+        for (std::size_t i = 0; i < count; i++) {
+            items[i] = buffer[(h + i) & mask];
+        }
+        head.store(h + count, std::memory_order_release);
+        return count;
+    }
+
+    bool empty() const {
+        return head.load(std::memory_order_acquire) == tail.load(std::memory_order_acquire);
+    }
+
+    std::size_t size() const {
+        return tail.load(std::memory_order_acquire) - head.load(std::memory_order_acquire);
+    }
+};
+
+// Multi producer / multi consumer (Vyukov's bounded queue). Every cell carries a sequence
+// number telling whether it is free for position pos (seq == pos) or holds the item
+// written at pos (seq == pos + 1), so producers and consumers only contend on the CAS
+// that claims a position.
+template <typename T>
+class MPMCRingBuffer {
+private:
+    struct Cell {
+        std::atomic<std::size_t> sequence;
+        T data;
+    };
+
+    const std::size_t capacity;
+    const std::size_t mask;
+    std::unique_ptr<Cell[]> buffer;
+
+    alignas(CACHE_LINE) std::atomic<std::size_t> enqueuePos;
+    alignas(CACHE_LINE) std::atomic<std::size_t> dequeuePos;
+
+    static void wait_for(const std::atomic<std::size_t>& sequence, std::size_t expected) {
+        while (sequence.load(std::memory_order_acquire) != expected) {
+            std::this_thread::yield();
+        }
+    }
+
+public:
+    explicit MPMCRingBuffer(std::size_t minCapacity)
+        : capacity(round_up_to_power_of_two(minCapacity < 2 ? 2 : minCapacity)),
+          mask(capacity - 1), buffer(new Cell[capacity]), enqueuePos(0), dequeuePos(0) {
+        for (std::size_t i = 0; i < capacity; i++) {
+            buffer[i].sequence.store(i, std::memory_order_relaxed);
+        }
+    }
+
+    MPMCRingBuffer(const MPMCRingBuffer&) = delete;
+    MPMCRingBuffer& operator=(const MPMCRingBuffer&) = delete;
+
+    bool push(const T& item) {
+        std::size_t pos = enqueuePos.load(std::memory_order_relaxed);
+        while (true) {
+            Cell& cell = buffer[pos & mask];
+            std::size_t seq = cell.sequence.load(std::memory_order_acquire);
+            std::ptrdiff_t diff = static_cast<std::ptrdiff_t>(seq) - static_cast<std::ptrdiff_t>(pos);
+            if (diff == 0) {
+                if (enqueuePos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                    cell.data = item;
+                    cell.sequence.store(pos + 1, std::memory_order_release);
+                    return true;
+                }
+            } else if (diff < 0) {
+                return false;
+            } else {
+                pos = enqueuePos.load(std::memory_order_relaxed);
+            }
+        }
+    }
+
+    bool pop(T& item) {
+        std::size_t pos = dequeuePos.load(std::memory_order_relaxed);
+        while (true) {
+            Cell& cell = buffer[pos & mask];
+            std::size_t seq = cell.sequence.load(std::memory_order_acquire);
+            std::ptrdiff_t diff = static_cast<std::ptrdiff_t>(seq) - static_cast<std::ptrdiff_t>(pos + 1);
+            if (diff == 0) {
+                if (dequeuePos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                    item = cell.data;
+                    cell.sequence.store(pos + mask + 1, std::memory_order_release);
+                    return true;
+                }
+            } else if (diff < 0) {
+                return false;
+            } else {
+                pos = dequeuePos.load(std::memory_order_relaxed);
+            }
+        }
+    }
+
+    // Claims a block of up to count positions with one CAS and fills it. A claimed cell may
+    // still be being read by the consumer that owns the previous lap, so each cell is
+    // waited on before it is written; that wait is bounded by one in-flight pop.
+    std::size_t push_n(const T* items, std::size_t count) {
+        std::size_t pos = enqueuePos.load(std::memory_order_relaxed);
+        std::size_t claimed;
+        while (true) {
+            std::size_t head = dequeuePos.load(std::memory_order_acquire);
+            if (head > pos) {
+                pos = enqueuePos.load(std::memory_order_relaxed);
+                continue;
+            }
+            std::size_t used = pos - head;
+            std::size_t free = used >= capacity ? 0 : capacity - used;
+            claimed = count < free ? count : free;
+            if (claimed == 0) {
+                return 0;
+            }
+            if (enqueuePos.compare_exchange_weak(pos, pos + claimed, std::memory_order_relaxed)) {
+                break;
+            }
+        }
+
+        for (std::size_t i = 0; i < claimed; i++) {
+            Cell& cell = buffer[(pos + i) & mask];
+            wait_for(cell.sequence, pos + i);
+            cell.data = items[i];
+            cell.sequence.store(pos + i + 1, std::memory_order_release);
+        }
+        return claimed;
+    }
+
+    // Mirror image of push_n: claims up to count published positions and drains them.
+    std::size_t pop_n(T* items, std::size_t count) {
+        std::size_t pos = dequeuePos.load(std::memory_order_relaxed);
+        std::size_t claimed;
+        do {
+            std::size_t end = enqueuePos.load(std::memory_order_acquire);
+            std::size_t available = end > pos ? end - pos : 0;
+            claimed = count < available ? count : available;
+            if (claimed == 0) {
+                return 0;
+            }
+        } while (!dequeuePos.compare_exchange_weak(pos, pos + claimed, std::memory_order_relaxed));
+
+        for (std::size_t i = 0; i < claimed; i++) {
+            Cell& cell = buffer[(pos + i) & mask];
+            wait_for(cell.sequence, pos + i + 1);
+            items[i] = cell.data;
+            cell.sequence.store(pos + i + mask + 1, std::memory_order_release);
+        }
+        return claimed;
+    }
+
+    bool empty() const {
+        return dequeuePos.load(std::memory_order_acquire) >= enqueuePos.load(std::memory_order_acquire);
+    }
+};
+
+#endif // RING_BUFFER_H
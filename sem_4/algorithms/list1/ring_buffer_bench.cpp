@@ -0,0 +1,137 @@
+#include <iostream>
+#include <iomanip>
+#include <string>
+#include <vector>
+#include <thread>
+#include <mutex>
+#include <atomic>
+#include <chrono>
+#include <functional>
+
+#include "fifo_lifo.h"
+#include "ring_buffer.h"
+
+const std::size_t BATCH = 64;
+const std::size_t CAPACITY = 1 << 16;
+
+struct LockedFIFO {
+    FIFO fifo{false};
+    std::mutex mtx;
+
+    bool push(int item) {
+        std::lock_guard<std::mutex> lock(mtx);
+        fifo.push(item);
+        return true;
+    }
+
+    bool pop(int& item) {
+        std::lock_guard<std::mutex> lock(mtx);
+        if (fifo.empty()) {
+            return false;
+        }
+        item = 0;
+        fifo.pop();
+        return true;
+    }
+};
+
+// Moves `items` values from producers to consumers and returns the throughput in items/s.
+// With a single thread the same thread alternates between pushing and popping a batch.
+double run(int threads, long long items,
+           const std::function<std::size_t(const int*, std::size_t)>& push,
+           const std::function<std::size_t(int*, std::size_t)>& pop,
+           std::size_t batch) {
+    auto start = std::chrono::steady_clock::now();
+
+    if (threads == 1) {
+        std::vector<int> in(batch), out(batch);
+        for (long long done = 0; done < items; done += batch) {
+            std::size_t pushed = 0;
+            while (pushed < batch) pushed += push(in.data() + pushed, batch - pushed);
+            std::size_t popped = 0;
+            while (popped < batch) popped += pop(out.data() + popped, batch - popped);
+        }
+    } else {
+        int producers = threads / 2;
+        int consumers = threads - producers;
+        long long perProducer = items / producers;
+        std::atomic<long long> remaining(perProducer * producers);
+        std::vector<std::thread> workers;
+
+        for (int p = 0; p < producers; p++) {
+            workers.emplace_back([&, p] {
+                std::vector<int> in(batch, p);
+                for (long long sent = 0; sent < perProducer;) {
+                    std::size_t want = std::min<long long>(batch, perProducer - sent);
+                    std::size_t pushed = push(in.data(), want);
+                    if (pushed == 0) std::this_thread::yield();
+                    sent += pushed;
+                }
+            });
+        }
+        for (int c = 0; c < consumers; c++) {
+            workers.emplace_back([&] {
+                std::vector<int> out(batch);
+                while (remaining.load(std::memory_order_relaxed) > 0) {
+                    std::size_t popped = pop(out.data(), batch);
+                    if (popped == 0) std::this_thread::yield();
+                    remaining.fetch_sub(popped, std::memory_order_relaxed);
+                }
+            });
+        }
+        for (auto& w : workers) w.join();
+    }
+
+    std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+    return items / elapsed.count();
+}
+
+template <typename Queue>
+double run_single(int threads, long long items, Queue& q) {
+    return run(threads, items,
+        [&](const int* in, std::size_t) -> std::size_t { return q.push(*in) ? 1 : 0; },
+        [&](int* out, std::size_t) -> std::size_t { return q.pop(*out) ? 1 : 0; }, 1);
+}
+
+template <typename Queue>
+double run_batch(int threads, long long items, Queue& q) {
+    return run(threads, items,
+        [&](const int* in, std::size_t n) { return q.push_n(in, n); },
+        [&](int* out, std::size_t n) { return q.pop_n(out, n); }, BATCH);
+}
+
+void print_row(int threads, const std::string& name, double throughput) {
+    std::cout << std::setw(7) << threads << "  " << std::left << std::setw(16) << name << std::right
+              << std::setw(14) << std::fixed << std::setprecision(2) << throughput / 1e6 << std::endl;
+}
+
+int main(int argc, char* argv[]) {
+    long long items = argc >= 2 ? std::stoll(argv[1]) : 1000000;
+
+    std::cout << "Items per run: " << items << std::endl;
+    std::cout << "Threads  Queue                 Mitems/s" << std::endl;
+
+    for (int threads : {1, 2, 4, 8, 16}) {
+        {
+            LockedFIFO q;
+            print_row(threads, "FIFO + mutex", run_single(threads, items, q));
+        }
+        {
+            MPMCRingBuffer<int> q(CAPACITY);
+            print_row(threads, "MPMC", run_single(threads, items, q));
+        }
+        {
+            MPMCRingBuffer<int> q(CAPACITY);
+            print_row(threads, "MPMC batch", run_batch(threads, items, q));
+        }
+        // SPSC is only valid with one producer and one consumer.
+        if (threads <= 2) {
+            SPSCRingBuffer<int> q(CAPACITY);
+            print_row(threads, "SPSC", run_single(threads, items, q));
+            SPSCRingBuffer<int> qb(CAPACITY);
+            print_row(threads, "SPSC batch", run_batch(threads, items, qb));
+        }
+    }
+
+    return 0;
+}
@@ -0,0 +1,59 @@
+#include <iostream>
+#include <iomanip>
+#include <random>
+#include <vector>
+#include <numeric>
+#include <algorithm>
+
+#include "cyclic_list.h"
+#include "double_cyclic_list.h"
+#include "zipf.h"
+
+// Usage: ./self_organizing [n] [queries] [zipf exponent]
+// The list holds keys 0..n-1 in random order; query ranks follow a Zipf law mapped onto a
+// random permutation of the keys so hot keys are scattered through the initial list.
+int main(int argc, char* argv[]) {
+    int n = argc >= 2 ? std::stoi(argv[1]) : 10000;
+    int queries = argc >= 3 ? std::stoi(argv[2]) : 100000;
+    double s = argc >= 4 ? std::stod(argv[3]) : 1.0;
+
+    std::random_device rd;
+    std::mt19937 rng(rd());
+
+    std::vector<int> order(n), popularity(n);
+    std::iota(order.begin(), order.end(), 0);
+    std::iota(popularity.begin(), popularity.end(), 0);
+    std::shuffle(order.begin(), order.end(), rng);
+    std::shuffle(popularity.begin(), popularity.end(), rng);
+
+    ZipfDistribution zipf(n, s);
+    std::vector<int> keys(queries);
+    for (int& key : keys) {
+        key = popularity[zipf(rng)];
+    }
+
+    std::cout << "n = " << n << ", queries = " << queries << ", Zipf s = " << s << std::endl;
+
+    const ReorganizePolicy policies[] = {ReorganizePolicy::STATIC, ReorganizePolicy::MOVE_TO_FRONT,
+                                         ReorganizePolicy::TRANSPOSE, ReorganizePolicy::COUNT};
+    for (ReorganizePolicy policy : policies) {
+        CyclicList list(policy);
+        DoubleCyclicList dlist(policy);
+        for (int key : order) {
+            list.insert(key);
+            dlist.insert(key);
+        }
+
+        long long single = 0, dbl = 0;
+        for (int key : keys) {
+            single += list.search(key);
+            dbl += dlist.search(key, rng);
+        }
+
+        std::cout << std::left << std::setw(15) << policy_name(policy) << std::right
+                  << "Average cost (CyclicList): " << std::setw(10) << single / double(queries)
+                  << "   (DoubleCyclicList): " << std::setw(10) << dbl / double(queries) << std::endl;
+    }
+
+    return 0;
+}
@@ -0,0 +1,89 @@
+#include <iostream>
+#include <random>
+#include <vector>
+#include <chrono>
+
+#include "cyclic_list.h"
+#include "chunked_cyclic_list.h"
+
+int main(int argc, char* argv[]) {
+    int n = argc >= 2 ? std::stoi(argv[1]) : 10000;
+    int queries = argc >= 3 ? std::stoi(argv[2]) : 1000;
+
+    std::random_device rd;
+    std::mt19937 rng(rd());
+    std::uniform_int_distribution<int> dist1(10, 99);
+    std::uniform_int_distribution<int> dist2(0, 100000);
+    std::uniform_int_distribution<int> index_dist(0, n - 1);
+
+    ChunkedCyclicList list1, list2;
+    for (int i = 0; i < 10; i++) {
+        list1.insert(dist1(rng));
+        list2.insert(dist1(rng));
+    }
+
+    std::cout << "List 1: ";
+    list1.print();
+
+    std::cout << "List 2: ";
+    list2.print();
+
+    list1.merge(list2);
+    std::cout << "Merged list: ";
+    list1.print();
+
+    std::vector<int> T(n);
+    CyclicList list;
+    ChunkedCyclicList chunked;
+
+    for (int i = 0; i < n; i++) {
+        T[i] = dist2(rng);
+        list.insert(T[i]);
+        chunked.insert(T[i]);
+    }
+
+    std::vector<int> fromList(queries), randomValues(queries);
+    for (int i = 0; i < queries; i++) {
+        fromList[i] = T[index_dist(rng)];
+        randomValues[i] = dist2(rng);
+    }
+
+#if defined(__AVX2__)
+    std::cout << "Vector width: AVX2 (8 keys)" << std::endl;
+#elif defined(__SSE2__)
+    std::cout << "Vector width: SSE2 (4 keys)" << std::endl;
+#else
+    std::cout << "Vector width: scalar" << std::endl;
+#endif
+
+    for (int pass = 0; pass < 2; pass++) {
+        const std::vector<int>& keys = pass == 0 ? fromList : randomValues;
+        const char* label = pass == 0 ? "elements from the list" : "random elements";
+
+        long long totalComparisons = 0;
+        auto t0 = std::chrono::steady_clock::now();
+        for (int key : keys) {
+            totalComparisons += list.search(key);
+        }
+        auto t1 = std::chrono::steady_clock::now();
+
+        long long chunkedComparisons = 0, vectorCompares = 0;
+        for (int key : keys) {
+            SearchResult r = chunked.search(key);
+            chunkedComparisons += r.comparisons;
+            vectorCompares += r.vectorCompares;
+        }
+        auto t2 = std::chrono::steady_clock::now();
+
+        double linearMs = std::chrono::duration<double, std::milli>(t1 - t0).count();
+        double simdMs = std::chrono::duration<double, std::milli>(t2 - t1).count();
+
+        std::cout << "Average cost (" << label << "): " << totalComparisons / double(queries) << std::endl;
+        std::cout << "  chunked: " << chunkedComparisons / double(queries) << " element comparisons, "
+                  << vectorCompares / double(queries) << " vector compares" << std::endl;
+        std::cout << "  time: linear " << linearMs << " ms, SIMD " << simdMs << " ms (x"
+                  << linearMs / simdMs << ")" << std::endl;
+    }
+
+    return 0;
+}
@@ -0,0 +1,258 @@
+#ifndef SKIP_CYCLIC_LIST_H
+#define SKIP_CYCLIC_LIST_H
+
+#include <iostream>
+#include <random>
+#include <vector>
+
+#include "double_cyclic_list.h"
+
+// Sorted DoubleCyclicList (head holds the minimum) with skip-list express lanes on top of
+// the ring. Lane 1 indexes roughly every 4th ring node, lane 2 every 16th and so on; each
+// lane is a singly linked list of IndexNodes whose `down` points one lane lower and, on
+// lane 1, whose `node` is the ring node itself. search() descends the lanes and finishes
+// with a short walk along the ring, so it takes O(log n) expected comparisons.
+
+const int SKIP_MAX_LEVEL = 24;
+
+struct IndexNode {
+    DoubleNode* node;
+    IndexNode* right;
+    IndexNode* down;
+    IndexNode(DoubleNode* node, IndexNode* right, IndexNode* down) : node(node), right(right), down(down) {}
+};
+
+class SkipCyclicList {
+public:
+    explicit SkipCyclicList(unsigned seed = 5489u) : levels(0), rng(seed) {
+        for (int i = 0; i < SKIP_MAX_LEVEL; i++) {
+            lanes[i] = nullptr;
+        }
+    }
+
+    ~SkipCyclicList() {
+        clear_lanes();
+    }
+
+    SkipCyclicList(const SkipCyclicList&) = delete;
+    SkipCyclicList& operator=(const SkipCyclicList&) = delete;
+
+    int size() const { return ring.size; }
+
+    // The ring in sorted order, read-only: the lanes point into it, so it is changed only
+    // through insert() and merge(), which keep them in sync.
+    const DoubleNode* head() const { return ring.head; }
+
+    void insert(int value) {
+        DoubleNode* newNode = new DoubleNode(value);
+        ring.size++;
+        ring.modifications++;
+        if (!ring.head) {
+            ring.head = newNode;
+            newNode->next = newNode;
+            newNode->prev = newNode;
+            add_tower(newNode, nullptr, 0);
+            return;
+        }
+
+        IndexNode* path[SKIP_MAX_LEVEL];
+        int comparisons = 0;
+        DoubleNode* before = find_predecessor(value, path, comparisons);
+        if (!before) {
+            // New minimum: it goes in front of head and becomes the new head.
+            link_after(ring.head->prev, newNode);
+            ring.head = newNode;
+        } else {
+            link_after(before, newNode);
+        }
+        add_tower(newNode, path, levels);
+    }
+
+    // Number of key comparisons needed to find value (or to establish that it is absent).
+    int search(int value) const {
+        if (!ring.head) {
+            return 0;
+        }
+        IndexNode* path[SKIP_MAX_LEVEL];
+        int comparisons = 0;
+        DoubleNode* before = find_predecessor(value, path, comparisons);
+        DoubleNode* candidate = before ? before->next : ring.head;
+        if (before && candidate == ring.head) {
+            return comparisons;  // larger than every key
+        }
+        return comparisons + 1;  // equality test against candidate
+    }
+
+    bool contains(int value) const {
+        if (!ring.head) {
+            return false;
+        }
+        IndexNode* path[SKIP_MAX_LEVEL];
+        int comparisons = 0;
+        DoubleNode* before = find_predecessor(value, path, comparisons);
+        DoubleNode* candidate = before ? before->next : ring.head;
+        return !(before && candidate == ring.head) && candidate->data == value;
+    }
+
+    // Linear merge of two sorted rings: nodes of list2 are spliced in between the nodes of
+    // this ring in one pass and the express lanes are rebuilt in one more pass.
+    void merge(SkipCyclicList& list2) {
+        if (!list2.ring.head) {
+            return;
+        }
+        DoubleNode* a = ring.head;
+        DoubleNode* b = list2.ring.head;
+        int na = ring.size, nb = list2.ring.size;
+
+        DoubleNode* first = nullptr;
+        DoubleNode* last = nullptr;
+        while (na > 0 || nb > 0) {
+            DoubleNode* take;
+            if (nb == 0 || (na > 0 && a->data <= b->data)) {
+                take = a;
+                a = a->next;
+                na--;
+            } else {
+                take = b;
+                b = b->next;
+                nb--;
+            }
+            if (!first) {
+                first = take;
+            } else {
+                last->next = take;
+                take->prev = last;
+            }
+            last = take;
+        }
+        last->next = first;
+        first->prev = last;
+
+        ring.head = first;
+        ring.size += list2.ring.size;
+        ring.modifications++;
+        list2.clear_lanes();
+        list2.ring.head = nullptr;
+        list2.ring.size = 0;
+        list2.ring.modifications++;
+        rebuild_lanes();
+    }
+
+    void print() {
+        ring.print();
+    }
+
+private:
+    DoubleCyclicList ring;
+    IndexNode* lanes[SKIP_MAX_LEVEL];  // lanes[i] is the sentinel (node == nullptr) of lane i + 1
+    int levels;
+    std::mt19937 rng;
+
+    int random_level() {
+        int level = 0;
+        while (level < SKIP_MAX_LEVEL && (rng() & 3) == 0) {
+            level++;
+        }
+        return level;
+    }
+
+    static void link_after(DoubleNode* before, DoubleNode* node) {
+        node->prev = before;
+        node->next = before->next;
+        before->next->prev = node;
+        before->next = node;
+    }
+
+    // Returns the last ring node with data < value, or nullptr if there is none (value is
+    // not greater than the minimum). path[i] receives the last lane-(i+1) index node
+    // visited, which is where a new tower has to be linked in.
+    DoubleNode* find_predecessor(int value, IndexNode** path, int& comparisons) const {
+        DoubleNode* before = nullptr;
+        for (int level = levels - 1; level >= 0; level--) {
+            IndexNode* x = level == levels - 1 ? lanes[level] : path[level + 1]->down;
+            while (x->right) {
+                comparisons++;
+                if (!(x->right->node->data < value)) {
+                    break;
+                }
+                x = x->right;
+            }
+            path[level] = x;
+            if (x->node) {
+                before = x->node;
+            }
+        }
+
+        // Finish on the ring, starting from the best node the lanes gave us.
+        DoubleNode* current = before ? before : ring.head;
+        if (!before) {
+            comparisons++;
+            if (!(current->data < value)) {
+                return nullptr;
+            }
+        }
+        while (current->next != ring.head) {
+            comparisons++;
+            if (!(current->next->data < value)) {
+                break;
+            }
+            current = current->next;
+        }
+        return current;
+    }
+
+    // Links a tower of random height above node. path[i] is the lane-(i+1) predecessor for
+    // the lanes that existed when it was recorded (pathLevels of them); lanes created here
+    // start from their sentinel.
+    void add_tower(DoubleNode* node, IndexNode** path, int pathLevels) {
+        int height = random_level();
+        IndexNode* below = nullptr;
+        for (int level = 0; level < height; level++) {
+            if (level >= levels) {
+                lanes[level] = new IndexNode(nullptr, nullptr, level > 0 ? lanes[level - 1] : nullptr);
+                levels++;
+            }
+            IndexNode* left = level < pathLevels ? path[level] : lanes[level];
+            IndexNode* index = new IndexNode(node, left->right, below);
+            left->right = index;
+            below = index;
+        }
+    }
+
+    void clear_lanes() {
+        for (int level = 0; level < levels; level++) {
+            IndexNode* x = lanes[level];
+            while (x) {
+                IndexNode* tmp = x;
+                x = x->right;
+                delete tmp;
+            }
+            lanes[level] = nullptr;
+        }
+        levels = 0;
+    }
+
+    void rebuild_lanes() {
+        clear_lanes();
+        IndexNode* tails[SKIP_MAX_LEVEL];
+        DoubleNode* current = ring.head;
+        do {
+            int height = random_level();
+            IndexNode* below = nullptr;
+            for (int level = 0; level < height; level++) {
+                if (level >= levels) {
+                    lanes[level] = new IndexNode(nullptr, nullptr, level > 0 ? lanes[level - 1] : nullptr);
+                    tails[level] = lanes[level];
+                    levels++;
+                }
+                IndexNode* index = new IndexNode(current, nullptr, below);
+                tails[level]->right = index;
+                tails[level] = index;
+                below = index;
+            }
+            current = current->next;
+        } while (current != ring.head);
+    }
+};
+
+#endif // SKIP_CYCLIC_LIST_H
@@ -0,0 +1,98 @@
+#include <iostream>
+#include <random>
+#include <vector>
+#include <chrono>
+
+#include "double_cyclic_list.h"
+#include "skip_cyclic_list.h"
+#include "bench_util.h"
+
+// Usage: ./skip_search [n] [queries] [linear queries]
+// The linear search over an unsorted DoubleCyclicList is O(n) per query, so it gets its own
+// (smaller) query count to keep the 10^7 run short.
+int main(int argc, char* argv[]) {
+    int n = argc >= 2 ? std::stoi(argv[1]) : 10000000;
+    int queries = argc >= 3 ? std::stoi(argv[2]) : 1000;
+    int linearQueries = argc >= 4 ? std::stoi(argv[3]) : 20;
+
+    std::random_device rd;
+    std::mt19937 rng(rd());
+    std::uniform_int_distribution<int> dist1(10, 99);
+    std::uniform_int_distribution<int> dist2(0, 2 * n - 1);
+    std::uniform_int_distribution<int> index_dist(0, n - 1);
+
+    SkipCyclicList list1(rd()), list2(rd());
+    for (int i = 0; i < 10; i++) {
+        list1.insert(dist1(rng));
+        list2.insert(dist1(rng));
+    }
+
+    std::cout << "List 1: ";
+    list1.print();
+
+    std::cout << "List 2: ";
+    list2.print();
+
+    list1.merge(list2);
+    std::cout << "Merged list: ";
+    list1.print();
+
+    std::vector<int> T(n);
+    for (int i = 0; i < n; i++) {
+        T[i] = dist2(rng);
+    }
+
+    auto start = std::chrono::steady_clock::now();
+    DoubleCyclicList list;
+    for (int i = 0; i < n; i++) {
+        list.insert(T[i]);
+    }
+    double linearBuildMs = elapsed_ms(start);
+
+    start = std::chrono::steady_clock::now();
+    SkipCyclicList sorted(rd());
+    for (int i = 0; i < n; i++) {
+        sorted.insert(T[i]);
+    }
+    double sortedBuildMs = elapsed_ms(start);
+
+    std::cout << "n = " << n << std::endl;
+    std::cout << "Build: unsorted " << linearBuildMs << " ms, sorted with express lanes " << sortedBuildMs << " ms" << std::endl;
+
+    for (int pass = 0; pass < 2; pass++) {
+        const char* label = pass == 0 ? "elements from the list" : "random elements";
+        std::vector<int> keys(queries);
+        for (int& key : keys) {
+            key = pass == 0 ? T[index_dist(rng)] : dist2(rng);
+        }
+
+        long long linearComparisons = 0;
+        start = std::chrono::steady_clock::now();
+        for (int i = 0; i < linearQueries && i < queries; i++) {
+            linearComparisons += list.search(keys[i], rng);
+        }
+        double linearMs = elapsed_ms(start) / std::min(linearQueries, queries);
+
+        long long skipComparisons = 0;
+        start = std::chrono::steady_clock::now();
+        for (int key : keys) {
+            skipComparisons += sorted.search(key);
+        }
+        double skipMs = elapsed_ms(start) / queries;
+
+        std::cout << "Average cost (" << label << "): linear " << linearComparisons / double(std::min(linearQueries, queries))
+                  << ", skip list " << skipComparisons / double(queries) << std::endl;
+        std::cout << "  time per search: linear " << linearMs << " ms, skip list " << skipMs * 1000 << " us" << std::endl;
+    }
+
+    // Merging two sorted halves is a single linear pass.
+    SkipCyclicList left(rd()), right(rd());
+    for (int i = 0; i < n / 10; i++) {
+        (i % 2 ? left : right).insert(T[i]);
+    }
+    start = std::chrono::steady_clock::now();
+    left.merge(right);
+    std::cout << "Merge of two sorted lists with " << n / 10 << " nodes in total: " << elapsed_ms(start) << " ms" << std::endl;
+
+    return 0;
+}
@@ -0,0 +1,123 @@
+#include <iostream>
+#include <iomanip>
+#include <vector>
+#include <thread>
+#include <atomic>
+#include <chrono>
+#include <random>
+
+#include "fifo_lifo.h"
+#include "work_stealing_deque.h"
+
+double seconds_since(std::chrono::steady_clock::time_point start) {
+    return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+}
+
+// The owner pushes 0..n-1 (in bursts, popping some of them back) while thieves steal.
+// Every value must be taken exactly once, by either the owner or a thief.
+bool stress_test(int n, int thieves, unsigned seed) {
+    WorkStealingDeque<int> deque(16);
+    std::vector<std::atomic<int>> taken(n);
+    for (auto& t : taken) t.store(0);
+    std::atomic<bool> done(false);
+
+    std::vector<std::thread> workers;
+    for (int i = 0; i < thieves; i++) {
+        workers.emplace_back([&] {
+            int item;
+            while (!done.load(std::memory_order_acquire) || !deque.empty()) {
+                if (deque.steal(item)) {
+                    taken[item].fetch_add(1);
+                }
+            }
+        });
+    }
+
+    std::mt19937 rng(seed);
+    int item;
+    for (int next = 0; next < n;) {
+        int burst = rng() % 64 + 1;
+        for (int i = 0; i < burst && next < n; i++) {
+            deque.push(next++);
+        }
+        int pops = rng() % 48;
+        for (int i = 0; i < pops; i++) {
+            if (deque.pop(item)) {
+                taken[item].fetch_add(1);
+            }
+        }
+    }
+    while (deque.pop(item)) {
+        taken[item].fetch_add(1);
+    }
+    done.store(true, std::memory_order_release);
+    for (auto& w : workers) w.join();
+
+    for (int i = 0; i < n; i++) {
+        if (taken[i].load() != 1) {
+            std::cout << "  value " << i << " taken " << taken[i].load() << " times" << std::endl;
+            return false;
+        }
+    }
+    return true;
+}
+
+// The owner fills the deque with n items and the thieves drain it; returns steals/s.
+double steal_throughput(int n, int thieves) {
+    WorkStealingDeque<int> deque(n);
+    for (int i = 0; i < n; i++) {
+        deque.push(i);
+    }
+    std::atomic<long long> stolen(0);
+    std::vector<std::thread> workers;
+    auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < thieves; i++) {
+        workers.emplace_back([&] {
+            int item;
+            long long local = 0;
+            while (!deque.empty()) {
+                if (deque.steal(item)) local++;
+            }
+            stolen.fetch_add(local);
+        });
+    }
+    for (auto& w : workers) w.join();
+    return stolen.load() / seconds_since(start);
+}
+
+int main(int argc, char* argv[]) {
+    int n = argc >= 2 ? std::stoi(argv[1]) : 1000000;
+    int maxThieves = argc >= 3 ? std::stoi(argv[2]) : 8;
+
+    std::cout << "Stress test (" << n << " items):" << std::endl;
+    bool ok = true;
+    for (int thieves = 1; thieves <= maxThieves; thieves *= 2) {
+        bool passed = stress_test(n, thieves, 1000 + thieves);
+        std::cout << "  " << thieves << " thieves: " << (passed ? "OK" : "FAILED") << std::endl;
+        ok = ok && passed;
+    }
+
+    std::cout << "Owner push/pop (" << n << " items):" << std::endl;
+    {
+        WorkStealingDeque<int> deque;
+        int item;
+        auto start = std::chrono::steady_clock::now();
+        for (int i = 0; i < n; i++) deque.push(i);
+        while (deque.pop(item)) {}
+        std::cout << "  WorkStealingDeque: " << std::fixed << std::setprecision(2)
+                  << 2.0 * n / seconds_since(start) / 1e6 << " Mops/s" << std::endl;
+
+        LIFO lifo(false);
+        start = std::chrono::steady_clock::now();
+        for (int i = 0; i < n; i++) lifo.push(i);
+        while (!lifo.empty()) lifo.pop();
+        std::cout << "  LIFO:              " << 2.0 * n / seconds_since(start) / 1e6 << " Mops/s" << std::endl;
+    }
+
+    std::cout << "Steal throughput (" << n << " items):" << std::endl;
+    for (int thieves = 1; thieves <= maxThieves; thieves *= 2) {
+        std::cout << "  " << thieves << " thieves: " << steal_throughput(n, thieves) / 1e6 << " Msteals/s" << std::endl;
+    }
+
+    return ok ? 0 : 1;
+}
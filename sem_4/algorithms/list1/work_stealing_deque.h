@@ -0,0 +1,138 @@
+#ifndef WORK_STEALING_DEQUE_H
+#define WORK_STEALING_DEQUE_H
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <type_traits>
+#include <vector>
+
+// Chase-Lev work-stealing deque (with the C11 memory orderings of Le et al., PPoPP 2013).
+// The owning thread uses it like LIFO: push() and pop() work on the bottom end. Any other
+// thread may steal() from the top end, which gives the oldest (usually largest) task.
+// The circular array doubles when full; retired arrays are kept until the deque is
+// destroyed because a thief may still be reading from one. T is stored in std::atomic, so
+// it should be a pointer or another small trivially copyable value.
+template <typename T>
+class WorkStealingDeque {
+    static_assert(std::is_trivially_copyable<T>::value, "WorkStealingDeque needs a trivially copyable T");
+
+private:
+    class CircularArray {
+    public:
+        explicit CircularArray(std::int64_t capacity)
+            : capacity(capacity), mask(capacity - 1), items(new std::atomic<T>[capacity]) {}
+
+        std::int64_t size() const { return capacity; }
+
+        T get(std::int64_t i) const {
+            return items[i & mask].load(std::memory_order_relaxed);
+        }
+
+        void put(std::int64_t i, T item) {
+            items[i & mask].store(item, std::memory_order_relaxed);
+        }
+
+        CircularArray* grow(std::int64_t bottom, std::int64_t top) const {
+            CircularArray* bigger = new CircularArray(capacity * 2);
+            for (std::int64_t i = top; i < bottom; i++) {
+                bigger->put(i, get(i));
+            }
+            return bigger;
+        }
+
+    private:
+        std::int64_t capacity;
+        std::int64_t mask;
+        std::unique_ptr<std::atomic<T>[]> items;
+    };
+
+    alignas(64) std::atomic<std::int64_t> top;
+    alignas(64) std::atomic<std::int64_t> bottom;
+    std::atomic<CircularArray*> array;
+    std::vector<std::unique_ptr<CircularArray>> retired;
+
+public:
+    explicit WorkStealingDeque(std::int64_t capacity = 1024) : top(0), bottom(0) {
+        std::int64_t c = 1;
+        while (c < capacity) {
+            c <<= 1;
+        }
+        array.store(new CircularArray(c), std::memory_order_relaxed);
+    }
+
+    ~WorkStealingDeque() {
+        delete array.load(std::memory_order_relaxed);
+    }
+
+    WorkStealingDeque(const WorkStealingDeque&) = delete;
+    WorkStealingDeque& operator=(const WorkStealingDeque&) = delete;
+
+    // Owner only.
+    void push(T item) {
+        std::int64_t b = bottom.load(std::memory_order_relaxed);
+        std::int64_t t = top.load(std::memory_order_acquire);
+        CircularArray* a = array.load(std::memory_order_relaxed);
+        if (b - t > a->size() - 1) {
+            CircularArray* bigger = a->grow(b, t);
+            retired.emplace_back(a);
+            array.store(bigger, std::memory_order_release);
+            a = bigger;
+        }
+        a->put(b, item);
+        std::atomic_thread_fence(std::memory_order_release);
+        bottom.store(b + 1, std::memory_order_relaxed);
+    }
+
+    // Owner only. Returns false when the deque is empty or a thief took the last item.
+    bool pop(T& item) {
+        std::int64_t b = bottom.load(std::memory_order_relaxed) - 1;
+        CircularArray* a = array.load(std::memory_order_relaxed);
+        bottom.store(b, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        std::int64_t t = top.load(std::memory_order_relaxed);
+
+        if (t > b) {
+            bottom.store(b + 1, std::memory_order_relaxed);
+            return false;
+        }
+        item = a->get(b);
+        if (t == b) {
+            // Last item: race the thieves for it.
+            bool won = top.compare_exchange_strong(t, t + 1, std::memory_order_seq_cst,
+                                                   std::memory_order_relaxed);
+            bottom.store(b + 1, std::memory_order_relaxed);
+            return won;
+        }
+        return true;
+    }
+
+    // Any thread. Returns false when the deque is empty or the steal lost a race.
+    bool steal(T& item) {
+        std::int64_t t = top.load(std::memory_order_acquire);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        std::int64_t b = bottom.load(std::memory_order_acquire);
+        if (t >= b) {
+            return false;
+        }
+        CircularArray* a = array.load(std::memory_order_consume);
+        item = a->get(t);
+        return top.compare_exchange_strong(t, t + 1, std::memory_order_seq_cst,
+                                           std::memory_order_relaxed);
+    }
+
+    bool empty() const {
+        std::int64_t b = bottom.load(std::memory_order_relaxed);
+        std::int64_t t = top.load(std::memory_order_relaxed);
+        return b <= t;
+    }
+
+    std::size_t size() const {
+        std::int64_t b = bottom.load(std::memory_order_relaxed);
+        std::int64_t t = top.load(std::memory_order_relaxed);
+        return b > t ? static_cast<std::size_t>(b - t) : 0;
+    }
+};
+
+#endif // WORK_STEALING_DEQUE_H
@@ -0,0 +1,189 @@
+#ifndef XOR_CYCLIC_LIST_H
+#define XOR_CYCLIC_LIST_H
+
+#include <cstdint>
+#include <iostream>
+#include <random>
+#include <vector>
+
+// Doubly linked cyclic list with one link word per node: link = address(prev) ^ address(next).
+// Walking needs two adjacent nodes, so the list keeps both head and tail (= head's prev);
+// from (prev, current) the next node is current->link ^ prev, in either direction.
+//
+// A 16-byte node still costs 32 bytes when every node is a separate new (glibc's minimum
+// chunk), the same as DoubleNode. Nodes therefore come from an arena owned by the list.
+
+struct XorNode {
+    int data;
+    std::uintptr_t link;
+};
+
+inline XorNode* xor_step(const XorNode* from, const XorNode* current) {
+    return reinterpret_cast<XorNode*>(current->link ^ reinterpret_cast<std::uintptr_t>(from));
+}
+
+inline std::uintptr_t xor_addr(const XorNode* a, const XorNode* b) {
+    return reinterpret_cast<std::uintptr_t>(a) ^ reinterpret_cast<std::uintptr_t>(b);
+}
+
+class XorNodeArena {
+private:
+    static const std::size_t BLOCK_NODES = 1 << 16;
+    std::vector<XorNode*> blocks;
+    std::size_t used;
+
+public:
+    XorNodeArena() : used(BLOCK_NODES) {}
+
+    ~XorNodeArena() {
+        for (XorNode* block : blocks) {
+            delete[] block;
+        }
+    }
+
+    XorNodeArena(const XorNodeArena&) = delete;
+    XorNodeArena& operator=(const XorNodeArena&) = delete;
+
+    XorNode* allocate(int value) {
+        if (used == BLOCK_NODES) {
+            blocks.push_back(new XorNode[BLOCK_NODES]);
+            used = 0;
+        }
+        XorNode* node = &blocks.back()[used++];
+        node->data = value;
+        node->link = 0;
+        return node;
+    }
+
+    // Takes over the blocks of another arena (used when lists are merged).
+    void absorb(XorNodeArena& other) {
+        if (other.blocks.empty()) {
+            return;
+        }
+        // Keep our partially used block last so allocation continues in it.
+        XorNode* current = blocks.empty() ? nullptr : blocks.back();
+        if (current) {
+            blocks.pop_back();
+        }
+        blocks.insert(blocks.end(), other.blocks.begin(), other.blocks.end());
+        if (current) {
+            blocks.push_back(current);
+        } else {
+            used = other.used;
+        }
+        other.blocks.clear();
+        other.used = BLOCK_NODES;
+    }
+
+    std::size_t bytes() const {
+        return blocks.size() * BLOCK_NODES * sizeof(XorNode);
+    }
+};
+
+class XorCyclicList {
+public:
+    XorNode* head;
+    XorNode* tail;
+    int size;
+
+    XorCyclicList() : head(nullptr), tail(nullptr), size(0) {}
+
+    XorCyclicList(const XorCyclicList&) = delete;
+    XorCyclicList& operator=(const XorCyclicList&) = delete;
+
+    // Appends before head (at the tail), like DoubleCyclicList::insert.
+    void insert(int value) {
+        XorNode* newNode = arena.allocate(value);
+        if (!head) {
+            head = tail = newNode;
+            newNode->link = 0;  // prev == next == itself
+        } else {
+            // newNode sits between tail and head.
+            newNode->link = xor_addr(tail, head);
+            tail->link ^= xor_addr(head, newNode);
+            head->link ^= xor_addr(tail, newNode);
+            tail = newNode;
+        }
+        size++;
+    }
+
+    // O(1) splice: ... tail1 -> head2 ... tail2 -> head1 ..., like DoubleCyclicList::merge.
+    void merge(XorCyclicList& list2) {
+        if (!list2.head) {
+            return;
+        }
+        if (!head) {
+            head = list2.head;
+            tail = list2.tail;
+        } else {
+            XorNode* head1 = head;
+            XorNode* tail1 = tail;
+            XorNode* head2 = list2.head;
+            XorNode* tail2 = list2.tail;
+            tail1->link ^= xor_addr(head1, head2);
+            head1->link ^= xor_addr(tail1, tail2);
+            tail2->link ^= xor_addr(head2, head1);
+            head2->link ^= xor_addr(tail2, tail1);
+            tail = tail2;
+        }
+        arena.absorb(list2.arena);
+        size += list2.size;
+        list2.head = list2.tail = nullptr;
+        list2.size = 0;
+    }
+
+    int search(int value, std::mt19937& rng) const {
+        if (!head) {
+            return 0;
+        }
+        std::uniform_int_distribution<int> dist(0, 1);
+        bool forward = dist(rng);
+        return search(value, forward);
+    }
+
+    int search(int value, bool forward) const {
+        if (!head) {
+            return 0;
+        }
+        int comparisons = 0;
+        XorNode* previous = forward ? tail : next_of_head();
+        XorNode* current = head;
+        for (int i = 0; i < size; i++) {
+            comparisons++;
+            if (current->data == value) {
+                return comparisons;
+            }
+            XorNode* following = xor_step(previous, current);
+            previous = current;
+            current = following;
+        }
+        return comparisons;
+    }
+
+    void print() const {
+        if (!head) {
+            std::cout << "List is empty\n";
+            return;
+        }
+        XorNode* previous = tail;
+        XorNode* current = head;
+        for (int i = 0; i < size; i++) {
+            std::cout << current->data << " ";
+            XorNode* following = xor_step(previous, current);
+            previous = current;
+            current = following;
+        }
+        std::cout << std::endl;
+    }
+
+    std::size_t arena_bytes() const { return arena.bytes(); }
+
+private:
+    XorNodeArena arena;
+
+    XorNode* next_of_head() const {
+        return xor_step(tail, head);
+    }
+};
+
+#endif // XOR_CYCLIC_LIST_H
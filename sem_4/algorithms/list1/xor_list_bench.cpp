@@ -0,0 +1,77 @@
+#include <iostream>
+#include <iomanip>
+#include <random>
+#include <chrono>
+
+#include "double_cyclic_list.h"
+#include "xor_cyclic_list.h"
+#include "bench_util.h"
+
+template <typename List, typename Search>
+void measure(const char* name, int n, Search search) {
+    long before = resident_kb();
+    auto start = std::chrono::steady_clock::now();
+    List list;
+    for (int i = 0; i < n; i++) {
+        list.insert(i);
+    }
+    double buildMs = elapsed_ms(start);
+    long memoryKb = resident_kb() - before;
+
+    // -1 is never in the list, so both searches walk the whole ring.
+    volatile int comparisons;
+    start = std::chrono::steady_clock::now();
+    comparisons = search(list, true);
+    double forwardMs = elapsed_ms(start);
+    start = std::chrono::steady_clock::now();
+    comparisons = search(list, false);
+    double backwardMs = elapsed_ms(start);
+    (void)comparisons;
+
+    std::cout << std::left << std::setw(18) << name << std::right << std::fixed << std::setprecision(1)
+              << std::setw(12) << memoryKb / 1024.0 << std::setw(12) << memoryKb * 1024.0 / n
+              << std::setw(12) << buildMs << std::setw(14) << forwardMs << std::setw(14) << backwardMs << std::endl;
+}
+
+// DoubleCyclicList::search picks its direction at random; this rng is seeded so that the
+// first draw is the wanted direction.
+std::mt19937 rng_for_direction(bool forward) {
+    for (unsigned seed = 1;; seed++) {
+        std::mt19937 rng(seed);
+        std::mt19937 probe(seed);
+        if (std::uniform_int_distribution<int>(0, 1)(probe) == forward) {
+            return rng;
+        }
+    }
+}
+
+int main(int argc, char* argv[]) {
+    int n = argc >= 2 ? std::stoi(argv[1]) : 10000000;
+
+    XorCyclicList list1, list2;
+    for (int i = 0; i < 5; i++) {
+        list1.insert(i);
+        list2.insert(10 + i);
+    }
+    list1.merge(list2);
+    std::cout << "Merged XOR list: ";
+    list1.print();
+
+    std::cout << "n = " << n << ", sizeof(DoubleNode) = " << sizeof(DoubleNode)
+              << ", sizeof(XorNode) = " << sizeof(XorNode) << std::endl;
+    std::cout << "Layout             memory[MB]  bytes/node  build [ms]  forward [ms]  backward [ms]" << std::endl;
+
+    run_isolated([n] {
+        measure<DoubleCyclicList>("DoubleCyclicList", n, [](DoubleCyclicList& list, bool forward) {
+            std::mt19937 rng = rng_for_direction(forward);
+            return list.search(-1, rng);
+        });
+    });
+    run_isolated([n] {
+        measure<XorCyclicList>("XorCyclicList", n, [](XorCyclicList& list, bool forward) {
+            return list.search(-1, forward);
+        });
+    });
+
+    return 0;
+}
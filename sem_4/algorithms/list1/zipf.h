@@ -0,0 +1,36 @@
+#ifndef ZIPF_H
+#define ZIPF_H
+
+#include <algorithm>
+#include <cmath>
+#include <random>
+#include <vector>
+
+// Zipf distribution over ranks 0..n-1: P(rank k) is proportional to 1 / (k + 1)^s.
+// The cumulative weights are precomputed once, so sampling is a binary search.
+class ZipfDistribution {
+private:
+    std::vector<double> cdf;
+    std::uniform_real_distribution<double> uniform;
+
+public:
+    ZipfDistribution(int n, double s) : cdf(n), uniform(0.0, 1.0) {
+        double sum = 0;
+        for (int k = 0; k < n; k++) {
+            sum += 1.0 / std::pow(k + 1, s);
+            cdf[k] = sum;
+        }
+        for (double& c : cdf) {
+            c /= sum;
+        }
+    }
+
+    template <typename Rng>
+    int operator()(Rng& rng) {
+        double u = uniform(rng);
+        int k = std::lower_bound(cdf.begin(), cdf.end(), u) - cdf.begin();
+        return std::min<int>(k, cdf.size() - 1);
+    }
+};
+
+#endif // ZIPF_H
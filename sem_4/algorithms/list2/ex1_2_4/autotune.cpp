@@ -0,0 +1,129 @@
+#include <iostream>
+#include <iomanip>
+#include <vector>
+#include <string>
+#include <random>
+#include <chrono>
+#include <algorithm>
+#include <functional>
+#include "../sorting/hybrid_sort.hpp"
+#include "../sorting/dual_pivot_quick_sort.hpp"
+#include "../sorting/parallel_quick_sort.hpp"
+#include "../sorting/parallel_merge_sort.hpp"
+#include "../sorting/tuning.hpp"
+using namespace std;
+
+// Usage: ./autotune [n] [reps] [config]
+// Times candidate values of the tunable cutoffs in this process, on this machine, on random
+// inputs of n elements, and stores the fastest as the size class n of the config file
+// (default sorting_tuning.cfg, see tuning.hpp). Programs use it only as listed below, never
+// with the arguments the experiment scripts pass:
+//   hybrid_threshold      hybridQuickSort's threshold, 1 to 48, with the insertion base case
+//                         hybrid_sort uses by default; hybrid_sort with "tuned"
+//   dual_pivot_base_size  largest range dualPivotQuickSort hands to its base case, 2 to 48;
+//                         dual_pivot_quick_sort with "tuned"
+//   parallel_cutoff       ParallelOptions::cutoff, powers of two from 2^8 up to n, timed
+//                         as the sum of the parallel quick, dual-pivot and merge sorts;
+//                         the parallel benches
+// Prints CSV: Parameter,Value,n,TimeMs (best of reps), and the chosen values to stderr.
+
+double best_ms(const vector<int>& input, int reps, const function<void(vector<int>&)>& sort) {
+    double best = 1e300;
+    for (int r = 0; r < reps; r++) {
+        vector<int> arr = input;
+        auto start = chrono::steady_clock::now();
+        sort(arr);
+        double ms = chrono::duration<double, milli>(chrono::steady_clock::now() - start).count();
+        if (!is_sorted(arr.begin(), arr.end())) {
+            cerr << "Result is NOT sorted" << endl;
+            exit(1);
+        }
+        best = min(best, ms);
+    }
+    return best;
+}
+
+// Times every candidate and returns the fastest one.
+long long tune(const string& parameter, const vector<long long>& candidates, const vector<int>& input, int reps,
+               const function<void(vector<int>&, long long)>& sort) {
+    long long bestValue = candidates.front();
+    double bestMs = 1e300;
+    for (long long value : candidates) {
+        double ms = best_ms(input, reps, [&](vector<int>& a) { sort(a, value); });
+        cout << parameter << "," << value << "," << input.size() << "," << ms << endl;
+        if (ms < bestMs) {
+            bestMs = ms;
+            bestValue = value;
+        }
+    }
+    return bestValue;
+}
+
+int main(int argc, char* argv[]) {
+    long long n = argc >= 2 ? stoll(argv[1]) : 1000000;
+    int reps = argc >= 3 ? stoi(argv[2]) : 3;
+    string config = argc >= 4 ? argv[3] : sorting::TUNING_FILE;
+    if (n < 2) {
+        cerr << "The input size must be at least 2!" << endl;
+        return 1;
+    }
+
+    mt19937 gen(12345);
+    uniform_int_distribution<int> dist(0, 2 * n - 1);
+    vector<int> input(n);
+    for (int& x : input) {
+        x = dist(gen);
+    }
+    sorting::NoCounting none;
+
+    cout << "Parameter,Value,n,TimeMs" << endl;
+    cout << fixed << setprecision(2);
+
+    sorting::Tuning tuning;
+    tuning.size = n;
+
+    vector<long long> thresholds;
+    for (long long t = 1; t <= 48; t++) {
+        thresholds.push_back(t);
+    }
+    tuning.hybridThreshold = static_cast<int>(
+        tune("hybrid_threshold", thresholds, input, reps, [&](vector<int>& a, long long threshold) {
+            sorting::hybridQuickSort(a.begin(), a.end(), static_cast<int>(threshold), less<int>(), none,
+                                     sorting::PartitionScheme::LOMUTO, sorting::BaseCase::INSERTION);
+        }));
+
+    vector<long long> baseSizes;
+    for (long long s = 2; s <= 48; s++) {
+        baseSizes.push_back(s);
+    }
+    tuning.dualPivotBaseSize = tune("dual_pivot_base_size", baseSizes, input, reps, [&](vector<int>& a, long long size) {
+        sorting::dualPivotQuickSort(a.begin(), a.end(), less<int>(), none, sorting::PartitionScheme::LOMUTO,
+                                    sorting::BaseCase::NETWORK, size);
+    });
+
+    vector<long long> cutoffs;
+    for (long long c = 1 << 8; c <= n; c *= 2) {
+        cutoffs.push_back(c);
+    }
+    if (cutoffs.empty()) {
+        cutoffs.push_back(n);
+    }
+    tuning.parallelCutoff = tune("parallel_cutoff", cutoffs, input, reps, [&](vector<int>& a, long long cutoff) {
+        sorting::ParallelOptions options;
+        options.cutoff = cutoff;
+        vector<int> b = a, c = a;
+        sorting::parallelQuickSort(a.begin(), a.end(), less<int>(), options);
+        sorting::parallelDualPivotQuickSort(b.begin(), b.end(), less<int>(), options);
+        sorting::parallelMergeSort(c.begin(), c.end(), less<int>(), options);
+    });
+
+    cerr << "Tuned for n = " << n << ": hybrid_threshold " << tuning.hybridThreshold << ", dual_pivot_base_size "
+         << tuning.dualPivotBaseSize << ", parallel_cutoff " << tuning.parallelCutoff << endl;
+    if (!sorting::saveTuning(tuning, config)) {
+        cerr << "Cannot write " << config << "!" << endl;
+        return 1;
+    }
+    cerr << "Saved to " << config << endl;
+
+    return 0;
+}
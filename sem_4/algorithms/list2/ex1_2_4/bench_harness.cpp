@@ -0,0 +1,226 @@
+#include <iostream>
+#include <iomanip>
+#include <vector>
+#include <string>
+#include <random>
+#include <chrono>
+#include <algorithm>
+#include <functional>
+#include <thread>
+#include <atomic>
+#include <cstdint>
+#include <cstdlib>
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#endif
+#include "../sorting/sorting.hpp"
+using namespace std;
+
+// Usage: ./bench_harness [ex1_2_4|ex3] [threads] [warmups]
+// Runs the experiments of run_experiments.sh (ex1_2_4, the default) or of
+// ../ex3/run_experiments.sh (ex3) in one process: the same algorithms, sizes and k, on
+// random keys from [0, 2n) generated in memory. Repetition r of size n sorts the input
+// seeded with (n, r), so all algorithms and all k see the same inputs. Each configuration
+// first sorts warmups (default 1) untimed inputs, then its k inputs twice: once with a
+// counting policy for the comparisons and swaps, once with NoCounting for the wall time
+// and the cycles (the time stamp counter on x86, 0 elsewhere). Configurations are
+// independent and spread over threads workers (default: all cores); use 1 when the
+// timings matter more than the total running time.
+//
+// Prints the CSV of the script, with the averages of the timed runs appended:
+//   ex1_2_4  Algorithm,Threshold,n,k,AvgComparisons,AvgSwaps,AvgTimeMs,AvgCycles
+//   ex3      Algorithm,n,k,AvgComparisons,AvgTimeMs,AvgCycles
+// e.g. ./bench_harness > experiment_results.csv for plot_results.py.
+
+const int OPTIMAL_THRESHOLD = 15;
+
+struct Config {
+    string algorithm;
+    string threshold;
+    int n;
+    int k;
+};
+
+struct Result {
+    double comparisons = 0;
+    double swaps = 0;
+    double ms = 0;
+    double cycles = 0;
+};
+
+uint64_t read_cycles() {
+#if defined(__x86_64__) || defined(__i386__)
+    return __rdtsc();
+#else
+    return 0;
+#endif
+}
+
+vector<int> random_input(int n, uint32_t rep) {
+    seed_seq seed{static_cast<uint32_t>(n), rep};
+    mt19937 gen(seed);
+    uniform_int_distribution<int> dist(0, 2 * n - 1);
+    vector<int> arr(n);
+    for (int& x : arr) {
+        x = dist(gen);
+    }
+    return arr;
+}
+
+template <typename Sort>
+Result measure(const Config& config, int warmups, Sort sort) {
+    sorting::NoCounting none;
+    for (int w = 0; w < warmups; w++) {
+        vector<int> arr = random_input(config.n, static_cast<uint32_t>(-1 - w));
+        sort(arr, none);
+    }
+
+    Result result;
+    for (int r = 0; r < config.k; r++) {
+        vector<int> input = random_input(config.n, r);
+
+        vector<int> arr = input;
+        sorting::CountingPolicy counter;
+        sort(arr, counter);
+        result.comparisons += counter.comparisons;
+        result.swaps += counter.swaps;
+
+        arr = input;
+        auto start = chrono::steady_clock::now();
+        uint64_t startCycles = read_cycles();
+        sort(arr, none);
+        uint64_t cycles = read_cycles() - startCycles;
+        result.ms += chrono::duration<double, milli>(chrono::steady_clock::now() - start).count();
+        result.cycles += cycles;
+
+        if (!is_sorted(arr.begin(), arr.end())) {
+            cerr << config.algorithm << " (n = " << config.n << ") did NOT sort its input!" << endl;
+            exit(1);
+        }
+    }
+    result.comparisons /= config.k;
+    result.swaps /= config.k;
+    result.ms /= config.k;
+    result.cycles /= config.k;
+    return result;
+}
+
+// The sorters as the drivers call them without arguments; hybrid_sort with the threshold
+// the script passes.
+Result run(const Config& config, int warmups) {
+    const string& a = config.algorithm;
+    if (a == "insertion_sort") {
+        return measure(config, warmups, [](vector<int>& arr, auto& policy) {
+            sorting::insertionSort(arr.begin(), arr.end(), less<int>(), policy);
+        });
+    }
+    if (a == "quick_sort") {
+        return measure(config, warmups, [](vector<int>& arr, auto& policy) {
+            sorting::quickSort(arr.begin(), arr.end(), less<int>(), policy);
+        });
+    }
+    if (a == "dual_pivot_quick_sort") {
+        return measure(config, warmups, [](vector<int>& arr, auto& policy) {
+            sorting::dualPivotQuickSort(arr.begin(), arr.end(), less<int>(), policy, sorting::PartitionScheme::LOMUTO,
+                                        sorting::BaseCase::NONE);
+        });
+    }
+    if (a == "hybrid_sort") {
+        return measure(config, warmups, [](vector<int>& arr, auto& policy) {
+            sorting::hybridQuickSort(arr.begin(), arr.end(), OPTIMAL_THRESHOLD, less<int>(), policy,
+                                     sorting::PartitionScheme::LOMUTO, sorting::BaseCase::INSERTION);
+        });
+    }
+    if (a == "radix_sort") {
+        return measure(config, warmups, [](vector<int>& arr, auto& policy) {
+            sorting::radixSort(arr.begin(), arr.end(), sorting::RADIX_DIGIT_BITS, sorting::RadixMode::LSD, policy);
+        });
+    }
+    if (a == "merge_sort") {
+        return measure(config, warmups, [](vector<int>& arr, auto& policy) {
+            sorting::mergeSort(arr.begin(), arr.end(), less<int>(), policy, sorting::BaseCase::NONE);
+        });
+    }
+    return measure(config, warmups, [](vector<int>& arr, auto& policy) {
+        sorting::adaptiveMergeSort(arr.begin(), arr.end(), less<int>(), policy);
+    });
+}
+
+// The configurations in the order the script writes them.
+vector<Config> make_configs(bool ex3) {
+    vector<string> smallAlgorithms, largeAlgorithms;
+    if (ex3) {
+        smallAlgorithms = largeAlgorithms = {"merge_sort", "adaptive_merge_sort"};
+    } else {
+        smallAlgorithms = {"insertion_sort", "quick_sort", "dual_pivot_quick_sort", "radix_sort", "hybrid_sort"};
+        largeAlgorithms = {"quick_sort", "dual_pivot_quick_sort", "hybrid_sort", "radix_sort"};
+    }
+    string threshold = to_string(OPTIMAL_THRESHOLD);
+    vector<int> ks = {1, 10, 100};
+
+    vector<Config> configs;
+    for (int k : ks) {
+        for (int n = 10; n <= 50; n += 10) {
+            for (const string& a : smallAlgorithms) {
+                configs.push_back({a, a == "hybrid_sort" ? threshold : "NA", n, k});
+            }
+        }
+    }
+    // For large n the script writes the threshold on every row.
+    for (int k : ks) {
+        for (int n = 1000; n <= 50000; n += 1000) {
+            for (const string& a : largeAlgorithms) {
+                configs.push_back({a, threshold, n, k});
+            }
+        }
+    }
+    return configs;
+}
+
+int main(int argc, char* argv[]) {
+    string schema = argc >= 2 ? argv[1] : "ex1_2_4";
+    int threads = argc >= 3 ? stoi(argv[2]) : max(1u, thread::hardware_concurrency());
+    int warmups = argc >= 4 ? stoi(argv[3]) : 1;
+    if (schema != "ex1_2_4" && schema != "ex3") {
+        cerr << "Usage: ./bench_harness [ex1_2_4|ex3] [threads] [warmups]" << endl;
+        return 1;
+    }
+    bool ex3 = schema == "ex3";
+
+    vector<Config> configs = make_configs(ex3);
+    vector<Result> results(configs.size());
+    atomic<size_t> next(0);
+    auto worker = [&]() {
+        for (size_t i = next++; i < configs.size(); i = next++) {
+            results[i] = run(configs[i], warmups);
+        }
+    };
+    vector<thread> pool;
+    for (int t = 1; t < threads; t++) {
+        pool.emplace_back(worker);
+    }
+    worker();
+    for (thread& t : pool) {
+        t.join();
+    }
+
+    cout << (ex3 ? "Algorithm,n,k,AvgComparisons,AvgTimeMs,AvgCycles"
+                 : "Algorithm,Threshold,n,k,AvgComparisons,AvgSwaps,AvgTimeMs,AvgCycles")
+         << endl;
+    cout << fixed << setprecision(2);
+    for (size_t i = 0; i < configs.size(); i++) {
+        const Config& c = configs[i];
+        const Result& r = results[i];
+        cout << c.algorithm << ",";
+        if (!ex3) {
+            cout << c.threshold << ",";
+        }
+        cout << c.n << "," << c.k << "," << r.comparisons << ",";
+        if (!ex3) {
+            cout << r.swaps << ",";
+        }
+        cout << setprecision(4) << r.ms << "," << setprecision(0) << r.cycles << setprecision(2) << endl;
+    }
+
+    return 0;
+}
@@ -1,123 +1,54 @@
 #include <iostream>
 #include <vector>
-#include <iomanip>
-#include <algorithm>
+#include "../sorting/dual_pivot_quick_sort.hpp"
+#include "../sorting/tuning.hpp"
+#include "../sorting/driver.hpp"
 using namespace std;
 
-int comparisons = 0;
-int swaps = 0;
-
-bool compare(int a, int b) {
-    comparisons++;
-    return a < b;
-}
-
-void swap_keys(vector<int>& arr, int i, int j) {
-    if (i != j) {
-        swaps++;
-        swap(arr[i], arr[j]);
-    }
-}
-
-void printArray(const vector<int>& arr) {
-    for (int num : arr)
-        cout << setw(2) << num << " ";
-    cout << endl;
-}
-
-bool is_sorted(const vector<int>& arr) {
-    for (size_t i = 1; i < arr.size(); i++) {
-        if (arr[i - 1] > arr[i])
-            return false;
-    }
-    return true;
-}
-
-void dualPivotPartition(vector<int>& arr, int low, int high, int& lp, int& rp, int n) {
-    if (low >= high) return;
-
-    if (compare(arr[high], arr[low])) 
-        swap_keys(arr, low, high);
-
-    int p = arr[low], q = arr[high];
-    int lt = low + 1, gt = high - 1, i = low + 1;
-    int small_count = 0, large_count = 0;
-
-    while (i <= gt) {
-        if (large_count > small_count) {
-            if (compare(q, arr[i])) {
-                swap_keys(arr, i, gt);
-                gt--;
-                large_count++;
-                continue;
-            } else if (compare(arr[i], p)) {
-                swap_keys(arr, i, lt);
-                lt++;
-                small_count++;
-            }
-        } else {
-            if (compare(arr[i], p)) {
-                swap_keys(arr, i, lt);
-                lt++;
-                small_count++;
-            } else if (compare(q, arr[i])) {
-                swap_keys(arr, i, gt);
-                gt--;
-                large_count++;
-                continue;
-            }
+// Counts comparisons and swaps; for small inputs also prints the array after every
+// partition and after every subarray is sorted.
+struct Trace : sorting::CountingPolicy {
+    vector<int>& arr;
+    bool verbose;
+    Trace(vector<int>& arr) : arr(arr), verbose(arr.size() < 40) {}
+
+    template <typename It>
+    void trace(sorting::SortEvent event, It first, It last, It lp, It rp) {
+        if (!verbose) {
+            return;
+        }
+        if (event == sorting::SortEvent::PARTITIONED) {
+            cout << "After partitioning [" << first - arr.begin() << ", " << last - arr.begin() - 1
+                 << "], pivots at " << lp - arr.begin() << " and " << rp - arr.begin() << ": ";
+            printArray(arr);
+        } else if (event == sorting::SortEvent::SORTED) {
+            cout << "After sorting [" << first - arr.begin() << ", " << last - arr.begin() - 1 << "]: ";
+            printArray(arr);
         }
-        i++;
-    }
-
-    swap_keys(arr, low, --lt);
-    swap_keys(arr, high, ++gt);
-
-    lp = lt;
-    rp = gt;
-
-    if (n < 40) {
-        cout << "After partitioning [" << low << ", " << high << "], pivots at " 
-             << lp << " and " << rp << ": ";
-        printArray(arr);
-    }
-}
-
-void dualPivotQuickSort(vector<int>& arr, int low, int high, int n) {
-    if (low >= high) return;
-
-    int lp, rp;
-    dualPivotPartition(arr, low, high, lp, rp, n);
-
-    if (lp > low)
-        dualPivotQuickSort(arr, low, lp - 1, n);
-    if (lp + 1 < rp)
-        dualPivotQuickSort(arr, lp + 1, rp - 1, n);
-    if (rp < high)
-        dualPivotQuickSort(arr, rp + 1, high, n);
-
-    if (n < 40) {
-        cout << "After sorting [" << low << ", " << high << "]: ";
-        printArray(arr);
-    }
-}
-
-int main() {
-    int n;
-    cin >> n;
-    vector<int> arr(n), original(n);
-
-    for (int i = 0; i < n; i++) {
-        cin >> arr[i];
-        original[i] = arr[i];
     }
+};
+
+// Usage: ./dual_pivot_quick_sort [lomuto|simd] [none|network|insertion|tuned] [-o sorted.bin] < input
+// By default there is no base case, so the counts are those of the plain algorithm. The
+// base cases take ranges of up to DUAL_PIVOT_BASE_SIZE elements; "tuned" is the network
+// with the size from sorting_tuning.cfg (see ./autotune), if there is one.
+int main(int argc, char* argv[]) {
+    string output = takeOutputPath(argc, argv);
+    sorting::PartitionScheme scheme = parseScheme(argc >= 2 ? argv[1] : "lomuto");
+    bool tuned = argc >= 3 && string(argv[2]) == "tuned";
+    sorting::BaseCase base = tuned ? sorting::BaseCase::NETWORK : parseBaseCase(argc >= 3 ? argv[2] : "none");
+    vector<int> arr = readArray();
+    vector<int> original = arr;
+    int n = arr.size();
+    long long baseSize = tuned ? sorting::loadTuning(n).dualPivotBaseSize : sorting::DUAL_PIVOT_BASE_SIZE;
 
     if (n < 40) {
         cout << "Initial array:" << endl;
         printArray(original);
     }
 
-    dualPivotQuickSort(arr, 0, n - 1, n);
+    Trace counter(arr);
+    sorting::dualPivotQuickSort(arr.begin(), arr.end(), less<int>(), counter, scheme, base, baseSize);
 
     if (n < 40) {
         cout << "Initial array (for comparison):" << endl;
@@ -126,13 +57,11 @@ int main() {
         printArray(arr);
     }
 
-    cout << "Comparisons: " << comparisons << endl;
-    cout << "Swaps: " << swaps << endl;
-
-    if (is_sorted(arr)) {
-        cout << "The array is sorted correctly." << endl;
-    } else {
-        cout << "The array is NOT sorted correctly." << endl;
+    cout << "Comparisons: " << counter.comparisons << endl;
+    cout << "Swaps: " << counter.swaps << endl;
+    printSortedCheck(arr);
+    if (!writeOutput(output, arr)) {
+        return 1;
     }
 
     return 0;
@@ -1,7 +1,13 @@
 #include <iostream>
+#include <string>
+#include <vector>
+#include "../sorting/array_file.hpp"
 
 using namespace std;
 
+// Usage: ./gen_reverse n [--binary]
+// Prints n - 1, n - 2, ..., 0 as "n a_1 ... a_n", or with --binary as an array file
+// (see list2/sorting/array_file.hpp).
 int main(int argc, char* argv[]) {
     if (argc < 2) {
         cerr << "Specify the size of the array!" << endl;
@@ -9,6 +15,15 @@ int main(int argc, char* argv[]) {
     }
 
     int n = stoi(argv[1]);
+    bool binary = argc >= 3 && string(argv[2]) == "--binary";
+
+    if (binary) {
+        vector<int> arr(n);
+        for (int i = 0; i < n; i++)
+            arr[i] = n - 1 - i;
+        return sorting::writeArrayFile(cout, arr.data(), arr.size()) ? 0 : 1;
+    }
+
     cout << n << endl;
 
     for (int i = n - 1; i >= 0; i--)
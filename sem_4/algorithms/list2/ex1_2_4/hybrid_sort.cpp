@@ -1,100 +1,60 @@
 #include <iostream>
+#include <string>
 #include <vector>
-#include <iomanip>
-#include <algorithm>
+#include "../sorting/hybrid_sort.hpp"
+#include "../sorting/tuning.hpp"
+#include "../sorting/driver.hpp"
 using namespace std;
 
-int comparisons = 0;
-int swaps = 0;
-const int THRESHOLD = 10;
+// Counts comparisons and swaps; for small inputs also prints every partitioned subarray and
+// every one finished by the base case.
+struct Trace : sorting::CountingPolicy {
+    vector<int>& arr;
+    bool verbose;
+    string baseCase;
+    Trace(vector<int>& arr, sorting::BaseCase base)
+        : arr(arr), verbose(arr.size() < 40),
+          baseCase(base == sorting::BaseCase::NETWORK ? "sorting network" : "insertion sort") {}
 
-bool compare(int a, int b) {
-    comparisons++;
-    return a < b;
-}
-
-void swap_keys(vector<int>& arr, int i, int j) {
-    swaps++;
-    swap(arr[i], arr[j]);
-}
-
-void printArray(const vector<int>& arr) {
-    for (int num : arr)
-        cout << setw(2) << num << " ";
-    cout << endl;
-}
-
-bool is_sorted(const vector<int>& arr) {
-    for (size_t i = 1; i < arr.size(); i++)
-        if (arr[i - 1] > arr[i])
-            return false;
-    return true;
-}
-
-void insertionSort(vector<int>& arr, int low, int high) {
-    for (int i = low + 1; i <= high; i++) {
-        int j = i;
-        while (j > low && compare(arr[j], arr[j - 1])) {
-            swap_keys(arr, j, j - 1);
-            j--;
-        }
-    }
-    if (arr.size() < 40) {
-        cout << "After insertion sort on subarray [" << low << ", " << high << "]:" << endl;
-        for (int k = low; k <= high; k++) {
-            cout << setw(2) << arr[k] << " ";
+    template <typename It>
+    void trace(sorting::SortEvent event, It first, It last, It pivot, It) {
+        if (!verbose) {
+            return;
         }
-        cout << endl;
-    }
-}
-
-int partition(vector<int>& arr, int low, int high) {
-    int pivot = arr[high];
-    int i = low - 1;
-    for (int j = low; j < high; j++) {
-        if (compare(arr[j], pivot)) {
-            i++;
-            swap_keys(arr, i, j);
+        if (event == sorting::SortEvent::SORTED) {
+            cout << "After " << baseCase << " on subarray [" << first - arr.begin() << ", "
+                 << last - arr.begin() - 1 << "]:" << endl;
+            printRange(first, last);
+        } else if (event == sorting::SortEvent::PARTITIONED) {
+            cout << "After partition with pivot " << *pivot
+                 << " in subarray [" << first - arr.begin() << ", " << last - arr.begin() - 1 << "]:" << endl;
+            printRange(first, last);
         }
     }
-    swap_keys(arr, i + 1, high);
-    return i + 1;
-}
+};
 
-void hybridQuickSort(vector<int>& arr, int low, int high) {
-    if (low < high) {
-        if (high - low < THRESHOLD) {
-            insertionSort(arr, low, high);
-        } else {
-            int p = partition(arr, low, high);
-            if (arr.size() < 40) {
-                cout << "After partition with pivot " << arr[p] 
-                     << " in subarray [" << low << ", " << high << "]:" << endl;
-                for (int k = low; k <= high; k++) {
-                    cout << setw(2) << arr[k] << " ";
-                }
-                cout << endl;
-            }
-            hybridQuickSort(arr, low, p - 1);
-            hybridQuickSort(arr, p + 1, high);
-        }
+// Usage: ./hybrid_sort [threshold|tuned] [lomuto|block|simd] [insertion|network] [-o sorted.bin] < input
+// Without a threshold it is HYBRID_THRESHOLD; "tuned" takes it from sorting_tuning.cfg (see
+// ./autotune, which tunes it for the insertion base case), falling back to HYBRID_THRESHOLD.
+int main(int argc, char* argv[]) {
+    string output = takeOutputPath(argc, argv);
+    sorting::PartitionScheme scheme = parseScheme(argc >= 3 ? argv[2] : "lomuto");
+    sorting::BaseCase base = parseBaseCase(argc >= 4 ? argv[3] : "insertion");
+    vector<int> arr = readArray();
+    vector<int> original = arr;
+    int n = arr.size();
+    int threshold = sorting::HYBRID_THRESHOLD;
+    if (argc >= 2) {
+        threshold = string(argv[1]) == "tuned" ? sorting::loadTuning(n).hybridThreshold : stoi(argv[1]);
     }
-}
 
-int main() {
-    int n;
-    cin >> n;
-    vector<int> arr(n), original(n);
-    for (int i = 0; i < n; i++) {
-        cin >> arr[i];
-        original[i] = arr[i];
-    }
     if (n < 40) {
         cout << "Initial array:" << endl;
         printArray(original);
     }
     
-    hybridQuickSort(arr, 0, n - 1);
+    Trace counter(arr, base);
+    sorting::hybridQuickSort(arr.begin(), arr.end(), threshold, less<int>(), counter, scheme, base);
     
     if (n < 40) {
         cout << "Initial array:" << endl;
@@ -104,13 +64,11 @@ int main() {
         printArray(arr);
     }
     
-    cout << "Comparisons: " << comparisons << endl;
-    cout << "Swaps: " << swaps << endl;
-    
-    if (is_sorted(arr)) {
-        cout << "The array is sorted correctly." << endl;
-    } else {
-        cout << "The array is NOT sorted correctly." << endl;
+    cout << "Comparisons: " << counter.comparisons << endl;
+    cout << "Swaps: " << counter.swaps << endl;
+    printSortedCheck(arr);
+    if (!writeOutput(output, arr)) {
+        return 1;
     }
     
     return 0;
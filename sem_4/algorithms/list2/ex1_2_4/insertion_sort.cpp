@@ -1,65 +1,38 @@
 #include <iostream>
 #include <vector>
-#include <iomanip>
-#include <algorithm>
+#include "../sorting/insertion_sort.hpp"
+#include "../sorting/driver.hpp"
 using namespace std;
 
-int comparisons = 0;
-int swaps = 0;
+// Counts comparisons and swaps; for small inputs also prints the array after every pass.
+struct Trace : sorting::CountingPolicy {
+    vector<int>& arr;
+    bool verbose;
+    Trace(vector<int>& arr) : arr(arr), verbose(arr.size() < 40) {}
 
-bool compare(int a, int b) {
-    comparisons++;
-    return a < b;
-}
-
-void swap_keys(vector<int>& arr, int i, int j) {
-    swaps++;
-    swap(arr[i], arr[j]);
-}
-
-void printArray(const vector<int>& arr) {
-    for (int num : arr)
-        cout << setw(2) << num << " ";
-    cout << endl;
-}
-
-bool is_sorted(const vector<int>& arr) {
-    for (size_t i = 1; i < arr.size(); i++)
-        if (arr[i - 1] > arr[i])
-            return false;
-    return true;
-}
-
-void insertionSort(vector<int>& arr) {
-    int n = arr.size();
-    for (int i = 1; i < n; i++) {
-        int j = i;
-        while (j > 0 && compare(arr[j], arr[j - 1])) {
-            swap_keys(arr, j, j - 1);
-            j--;
-        }
-        if (n < 40) {
-            cout << "After iteration " << i << ": ";
+    template <typename It>
+    void trace(sorting::SortEvent event, It first, It, It mark, It) {
+        if (verbose && event == sorting::SortEvent::INSERTION_PASS) {
+            cout << "After iteration " << mark - first << ": ";
             printArray(arr);
         }
     }
-}
+};
 
-int main() {
-    int n;
-    cin >> n;
-    vector<int> arr(n), original(n);
-    for (int i = 0; i < n; i++) {
-        cin >> arr[i];
-        original[i] = arr[i];
-    }
+// Usage: ./insertion_sort [-o sorted.bin] < input
+int main(int argc, char* argv[]) {
+    string output = takeOutputPath(argc, argv);
+    vector<int> arr = readArray();
+    vector<int> original = arr;
+    int n = arr.size();
 
     if (n < 40) {
         cout << "Initial array:" << endl;
         printArray(original);
     }
 
-    insertionSort(arr);
+    Trace counter(arr);
+    sorting::insertionSort(arr.begin(), arr.end(), less<int>(), counter);
 
     if (n < 40) {
         cout << "Initial array:" << endl;
@@ -69,13 +42,11 @@ int main() {
         printArray(arr);
     }
 
-    cout << "Comparisons: " << comparisons << endl;
-    cout << "Swaps: " << swaps << endl;
-    
-    if (is_sorted(arr)) {
-        cout << "The array is sorted correctly." << endl;
-    } else {
-        cout << "The array is NOT sorted correctly." << endl;
+    cout << "Comparisons: " << counter.comparisons << endl;
+    cout << "Swaps: " << counter.swaps << endl;
+    printSortedCheck(arr);
+    if (!writeOutput(output, arr)) {
+        return 1;
     }
 
     return 0;
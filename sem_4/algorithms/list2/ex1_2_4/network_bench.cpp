@@ -0,0 +1,68 @@
+#include <iostream>
+#include <iomanip>
+#include <vector>
+#include <string>
+#include <random>
+#include <chrono>
+#include <functional>
+#include "../sorting/hybrid_sort.hpp"
+#include "../sorting/dual_pivot_quick_sort.hpp"
+#include "../sorting/merge_sort.hpp"
+using namespace std;
+
+// Usage: ./network_bench [n] [reps]
+// Insertion sort vs sorting networks as the base case on the same random input: the hybrid
+// sort at every threshold a network covers (1 to MAX_NETWORK_SIZE - 1), then the dual-pivot
+// and merge sorts at their fixed base sizes. Prints CSV:
+// Algorithm,Threshold,n,InsertionMs,NetworkMs,Speedup (best of reps).
+
+double best_ms(const vector<int>& input, int reps, const function<void(vector<int>&)>& run) {
+    double best = 1e300;
+    for (int r = 0; r < reps; r++) {
+        vector<int> arr = input;
+        auto start = chrono::steady_clock::now();
+        run(arr);
+        best = min(best, chrono::duration<double, milli>(chrono::steady_clock::now() - start).count());
+    }
+    return best;
+}
+
+void compare(const string& name, long long threshold, const vector<int>& input, int reps,
+             const function<void(vector<int>&, sorting::BaseCase)>& run) {
+    double insertion = best_ms(input, reps, [&](vector<int>& a) { run(a, sorting::BaseCase::INSERTION); });
+    double network = best_ms(input, reps, [&](vector<int>& a) { run(a, sorting::BaseCase::NETWORK); });
+    cout << name << "," << threshold << "," << input.size() << "," << insertion << "," << network << ","
+         << insertion / network << endl;
+}
+
+int main(int argc, char* argv[]) {
+    long long n = argc >= 2 ? stoll(argv[1]) : 1000000;
+    int reps = argc >= 3 ? stoi(argv[2]) : 5;
+
+    mt19937 gen(12345);
+    uniform_int_distribution<int> dist(0, 2 * n - 1);
+    vector<int> input(n);
+    for (int& x : input) {
+        x = dist(gen);
+    }
+    sorting::NoCounting none;
+
+    cout << "Algorithm,Threshold,n,InsertionMs,NetworkMs,Speedup" << endl;
+    cout << fixed << setprecision(2);
+    for (int threshold = 1; threshold < sorting::MAX_NETWORK_SIZE; threshold++) {
+        compare("hybrid_sort", threshold, input, reps, [&](vector<int>& a, sorting::BaseCase base) {
+            sorting::hybridQuickSort(a.begin(), a.end(), threshold, less<int>(), none,
+                                     sorting::PartitionScheme::LOMUTO, base);
+        });
+    }
+    compare("dual_pivot_quick_sort", sorting::DUAL_PIVOT_BASE_SIZE, input, reps,
+            [&](vector<int>& a, sorting::BaseCase base) {
+                sorting::dualPivotQuickSort(a.begin(), a.end(), less<int>(), none,
+                                            sorting::PartitionScheme::LOMUTO, base);
+            });
+    compare("merge_sort", sorting::MERGE_BASE_SIZE, input, reps, [&](vector<int>& a, sorting::BaseCase base) {
+        sorting::mergeSort(a.begin(), a.end(), less<int>(), none, base);
+    });
+
+    return 0;
+}
@@ -0,0 +1,86 @@
+#include <iostream>
+#include <iomanip>
+#include <vector>
+#include <string>
+#include <random>
+#include <chrono>
+#include <algorithm>
+#include <functional>
+#include <thread>
+#include "../sorting/quick_sort.hpp"
+#include "../sorting/dual_pivot_quick_sort.hpp"
+#include "../sorting/parallel_quick_sort.hpp"
+#include "../sorting/tuning.hpp"
+using namespace std;
+
+// Usage: ./parallel_sort_bench [n] [max_threads] [reps]
+// Speedup of parallelQuickSort / parallelDualPivotQuickSort over the sequential sorts on
+// the same random input, for 1, 2, 4, ... up to max_threads threads. Prints CSV:
+// Algorithm,Threads,n,TimeMs,Speedup (best of reps).
+
+double best_ms(const vector<int>& input, int reps, const function<void(vector<int>&)>& sort) {
+    double best = 1e300;
+    for (int r = 0; r < reps; r++) {
+        vector<int> arr = input;
+        auto start = chrono::steady_clock::now();
+        sort(arr);
+        double ms = chrono::duration<double, milli>(chrono::steady_clock::now() - start).count();
+        if (!is_sorted(arr.begin(), arr.end())) {
+            cerr << "Result is NOT sorted" << endl;
+            exit(1);
+        }
+        best = min(best, ms);
+    }
+    return best;
+}
+
+int main(int argc, char* argv[]) {
+    long long n = argc >= 2 ? stoll(argv[1]) : 10000000;
+    int maxThreads = argc >= 3 ? stoi(argv[2]) : max(1u, thread::hardware_concurrency());
+    int reps = argc >= 4 ? stoi(argv[3]) : 3;
+
+    mt19937 gen(12345);
+    uniform_int_distribution<int> dist(0, 2 * n - 1);
+    vector<int> input(n);
+    for (int& x : input) {
+        x = dist(gen);
+    }
+
+    // The task cutoff tuned for this size by ./autotune, if sorting_tuning.cfg has one.
+    long long cutoff = sorting::loadTuning(n).parallelCutoff;
+
+    vector<int> threadCounts;
+    for (int t = 1; t < maxThreads; t *= 2) {
+        threadCounts.push_back(t);
+    }
+    threadCounts.push_back(maxThreads);
+
+    cout << "Algorithm,Threads,n,TimeMs,Speedup" << endl;
+    cout << fixed << setprecision(2);
+
+    double seq = best_ms(input, reps, [](vector<int>& a) { sorting::quickSort(a.begin(), a.end()); });
+    cout << "quick_sort,1," << n << "," << seq << ",1.00" << endl;
+    for (int t : threadCounts) {
+        sorting::ParallelOptions options;
+        options.threads = t;
+        options.cutoff = cutoff;
+        double ms = best_ms(input, reps, [&](vector<int>& a) {
+            sorting::parallelQuickSort(a.begin(), a.end(), less<int>(), options);
+        });
+        cout << "parallel_quick_sort," << t << "," << n << "," << ms << "," << seq / ms << endl;
+    }
+
+    seq = best_ms(input, reps, [](vector<int>& a) { sorting::dualPivotQuickSort(a.begin(), a.end()); });
+    cout << "dual_pivot_quick_sort,1," << n << "," << seq << ",1.00" << endl;
+    for (int t : threadCounts) {
+        sorting::ParallelOptions options;
+        options.threads = t;
+        options.cutoff = cutoff;
+        double ms = best_ms(input, reps, [&](vector<int>& a) {
+            sorting::parallelDualPivotQuickSort(a.begin(), a.end(), less<int>(), options);
+        });
+        cout << "parallel_dual_pivot_quick_sort," << t << "," << n << "," << ms << "," << seq / ms << endl;
+    }
+
+    return 0;
+}
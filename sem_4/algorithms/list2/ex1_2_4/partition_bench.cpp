@@ -0,0 +1,172 @@
+#include <iostream>
+#include <iomanip>
+#include <vector>
+#include <string>
+#include <random>
+#include <chrono>
+#include <algorithm>
+#include <functional>
+#include <cstring>
+#include "../sorting/quick_sort.hpp"
+#include "../sorting/dual_pivot_quick_sort.hpp"
+#include "../sorting/hybrid_sort.hpp"
+#ifdef __linux__
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+using namespace std;
+
+// Usage: ./partition_bench [n] [reps]
+// Lomuto vs block (BlockQuicksort) vs SIMD vs dual-pivot partitioning on the same random
+// input: one top-level partition of all n elements, then whole sorts. Prints CSV:
+// Algorithm,n,TimeMs,BranchMisses (best of reps). Branch misses come from
+// perf_event_open and read NA where the kernel does not allow it (perf_event_paranoid,
+// containers, non-Linux).
+
+// Counts the calling thread's mispredicted branches in user space.
+class BranchMissCounter {
+private:
+    int fd = -1;
+
+public:
+    BranchMissCounter() {
+#ifdef __linux__
+        perf_event_attr attr;
+        memset(&attr, 0, sizeof(attr));
+        attr.size = sizeof(attr);
+        attr.type = PERF_TYPE_HARDWARE;
+        attr.config = PERF_COUNT_HW_BRANCH_MISSES;
+        attr.disabled = 1;
+        attr.exclude_kernel = 1;
+        attr.exclude_hv = 1;
+        fd = static_cast<int>(syscall(SYS_perf_event_open, &attr, 0, -1, -1, 0));
+#endif
+    }
+
+    ~BranchMissCounter() {
+#ifdef __linux__
+        if (fd >= 0) {
+            close(fd);
+        }
+#endif
+    }
+
+    bool available() const { return fd >= 0; }
+
+    void start() {
+#ifdef __linux__
+        if (fd >= 0) {
+            ioctl(fd, PERF_EVENT_IOC_RESET, 0);
+            ioctl(fd, PERF_EVENT_IOC_ENABLE, 0);
+        }
+#endif
+    }
+
+    long long stop() {
+        long long count = -1;
+#ifdef __linux__
+        if (fd >= 0) {
+            ioctl(fd, PERF_EVENT_IOC_DISABLE, 0);
+            if (read(fd, &count, sizeof(count)) != sizeof(count)) {
+                count = -1;
+            }
+        }
+#endif
+        return count;
+    }
+};
+
+void measure(const string& name, const vector<int>& input, int reps, BranchMissCounter& misses,
+             const function<void(vector<int>&)>& run) {
+    double best = 1e300;
+    long long bestMisses = -1;
+    for (int r = 0; r < reps; r++) {
+        vector<int> arr = input;
+        misses.start();
+        auto start = chrono::steady_clock::now();
+        run(arr);
+        double ms = chrono::duration<double, milli>(chrono::steady_clock::now() - start).count();
+        long long count = misses.stop();
+        if (ms < best) {
+            best = ms;
+            bestMisses = count;
+        }
+    }
+    cout << name << "," << input.size() << "," << best << ",";
+    if (bestMisses >= 0) {
+        cout << bestMisses << endl;
+    } else {
+        cout << "NA" << endl;
+    }
+}
+
+int main(int argc, char* argv[]) {
+    long long n = argc >= 2 ? stoll(argv[1]) : 10000000;
+    int reps = argc >= 3 ? stoi(argv[2]) : 3;
+
+    mt19937 gen(12345);
+    uniform_int_distribution<int> dist(0, 2 * n - 1);
+    vector<int> input(n);
+    for (int& x : input) {
+        x = dist(gen);
+    }
+
+    BranchMissCounter misses;
+    if (!misses.available()) {
+        cerr << "perf_event_open is not available here; BranchMisses will read NA" << endl;
+    }
+    cerr << "simdPartition runs on " << sorting::simdPartitionIsa() << endl;
+    sorting::NoCounting none;
+
+    cout << "Algorithm,n,TimeMs,BranchMisses" << endl;
+    cout << fixed << setprecision(2);
+    measure("lomuto_partition", input, reps, misses, [&](vector<int>& a) {
+        sorting::partition(a.begin(), a.end(), less<int>(), none);
+    });
+    measure("block_partition", input, reps, misses, [&](vector<int>& a) {
+        sorting::blockPartition(a.begin(), a.end(), less<int>(), none);
+    });
+    measure("simd_partition", input, reps, misses, [&](vector<int>& a) {
+        sorting::vectorPartition(a.begin(), a.end(), less<int>(), none);
+    });
+    measure("dual_pivot_partition", input, reps, misses, [&](vector<int>& a) {
+        vector<int>::iterator lp, rp;
+        sorting::dualPivotPartition(a.begin(), a.end(), lp, rp, less<int>(), none);
+    });
+    measure("dual_pivot_simd_partition", input, reps, misses, [&](vector<int>& a) {
+        vector<int>::iterator lp, rp;
+        sorting::vectorDualPivotPartition(a.begin(), a.end(), lp, rp, less<int>(), none);
+    });
+
+    measure("quick_sort_lomuto", input, reps, misses, [&](vector<int>& a) {
+        sorting::quickSort(a.begin(), a.end(), less<int>(), none, sorting::PartitionScheme::LOMUTO);
+    });
+    measure("quick_sort_block", input, reps, misses, [&](vector<int>& a) {
+        sorting::quickSort(a.begin(), a.end(), less<int>(), none, sorting::PartitionScheme::BLOCK);
+    });
+    measure("quick_sort_simd", input, reps, misses, [&](vector<int>& a) {
+        sorting::quickSort(a.begin(), a.end(), less<int>(), none, sorting::PartitionScheme::SIMD);
+    });
+    measure("hybrid_sort_lomuto", input, reps, misses, [&](vector<int>& a) {
+        sorting::hybridQuickSort(a.begin(), a.end(), sorting::HYBRID_THRESHOLD, less<int>(), none,
+                                 sorting::PartitionScheme::LOMUTO);
+    });
+    measure("hybrid_sort_block", input, reps, misses, [&](vector<int>& a) {
+        sorting::hybridQuickSort(a.begin(), a.end(), sorting::HYBRID_THRESHOLD, less<int>(), none,
+                                 sorting::PartitionScheme::BLOCK);
+    });
+    measure("hybrid_sort_simd", input, reps, misses, [&](vector<int>& a) {
+        sorting::hybridQuickSort(a.begin(), a.end(), sorting::HYBRID_THRESHOLD, less<int>(), none,
+                                 sorting::PartitionScheme::SIMD);
+    });
+    measure("dual_pivot_quick_sort", input, reps, misses, [&](vector<int>& a) {
+        sorting::dualPivotQuickSort(a.begin(), a.end(), less<int>(), none);
+    });
+    measure("dual_pivot_quick_sort_simd", input, reps, misses, [&](vector<int>& a) {
+        sorting::dualPivotQuickSort(a.begin(), a.end(), less<int>(), none, sorting::PartitionScheme::SIMD);
+    });
+
+    return 0;
+}
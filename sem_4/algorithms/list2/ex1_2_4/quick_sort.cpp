@@ -1,76 +1,48 @@
 #include <iostream>
+#include <string>
 #include <vector>
-#include <iomanip>
-#include <algorithm>
+#include "../sorting/intro_sort.hpp"
+#include "../sorting/quick_sort.hpp"
+#include "../sorting/driver.hpp"
 using namespace std;
 
-int comparisons = 0;
-int swaps = 0;
-
-bool compare(int a, int b) {
-    comparisons++;
-    return a < b;
-}
-
-void swap_keys(vector<int>& arr, int i, int j) {
-    swaps++;
-    swap(arr[i], arr[j]);
-}
-
-void printArray(const vector<int>& arr) {
-    for (int num : arr)
-        cout << setw(2) << num << " ";
-    cout << endl;
-}
-
-bool is_sorted(const vector<int>& arr) {
-    for (size_t i = 1; i < arr.size(); i++)
-        if (arr[i - 1] > arr[i])
-            return false;
-    return true;
-}
-
-int partition(vector<int>& arr, int low, int high) {
-    int pivot = arr[high];
-    int i = low - 1;
-    for (int j = low; j < high; j++) {
-        if (compare(arr[j], pivot)) {
-            i++;
-            swap_keys(arr, i, j);
-        }
-    }
-    swap_keys(arr, i + 1, high);
-    return i + 1;
-}
-
-void quickSort(vector<int>& arr, int low, int high) {
-    if (low < high) {
-        int p = partition(arr, low, high);
-        if (arr.size() < 40) {
-            cout << "After partition with pivot " << arr[p] 
-                 << " in subarray [" << low << ", " << high << "]:" << endl;
+// Counts comparisons and swaps; for small inputs also prints the array after every partition.
+struct Trace : sorting::CountingPolicy {
+    vector<int>& arr;
+    bool verbose;
+    Trace(vector<int>& arr) : arr(arr), verbose(arr.size() < 40) {}
+
+    template <typename It>
+    void trace(sorting::SortEvent event, It first, It last, It pivot, It) {
+        if (verbose && event == sorting::SortEvent::PARTITIONED) {
+            cout << "After partition with pivot " << *pivot
+                 << " in subarray [" << first - arr.begin() << ", " << last - arr.begin() - 1 << "]:" << endl;
             printArray(arr);
         }
-        quickSort(arr, low, p - 1);
-        quickSort(arr, p + 1, high);
-    }
-}
-
-int main() {
-    int n;
-    cin >> n;
-    vector<int> arr(n), original(n);
-    for (int i = 0; i < n; i++) {
-        cin >> arr[i];
-        original[i] = arr[i];
     }
+};
+
+// Usage: ./quick_sort [lomuto|block|simd|intro] [-o sorted.bin] < input
+// "intro" runs the pattern-defeating introsort instead of the plain quicksort.
+int main(int argc, char* argv[]) {
+    string output = takeOutputPath(argc, argv);
+    string mode = argc >= 2 ? argv[1] : "lomuto";
+    sorting::PartitionScheme scheme = parseScheme(mode);
+    vector<int> arr = readArray();
+    vector<int> original = arr;
+    int n = arr.size();
     
     if (n < 40) {
         cout << "Initial array:" << endl;
         printArray(original);
     }
 
-    quickSort(arr, 0, n - 1);
+    Trace counter(arr);
+    if (mode == "intro") {
+        sorting::introSort(arr.begin(), arr.end(), less<int>(), counter);
+    } else {
+        sorting::quickSort(arr.begin(), arr.end(), less<int>(), counter, scheme);
+    }
 
     if (n < 40) {
         cout << "Initial array:" << endl;
@@ -80,13 +52,11 @@ int main() {
         printArray(arr);
     }
     
-    cout << "Comparisons: " << comparisons << endl;
-    cout << "Swaps: " << swaps << endl;
-    
-    if (is_sorted(arr)) {
-        cout << "The array is sorted correctly." << endl;
-    } else {
-        cout << "The array is NOT sorted correctly." << endl;
+    cout << "Comparisons: " << counter.comparisons << endl;
+    cout << "Swaps: " << counter.swaps << endl;
+    printSortedCheck(arr);
+    if (!writeOutput(output, arr)) {
+        return 1;
     }
     
     return 0;
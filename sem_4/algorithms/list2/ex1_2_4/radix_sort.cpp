@@ -0,0 +1,64 @@
+#include <iostream>
+#include <string>
+#include <vector>
+#include "../sorting/radix_sort.hpp"
+#include "../sorting/driver.hpp"
+using namespace std;
+
+// Counts comparisons and swaps (LSD makes neither: it only moves keys, and MSD compares only
+// inside the small buckets it insertion-sorts); for small inputs also prints every digit
+// pass. An LSD pass may leave its result in the scratch buffer, so only that range is printed.
+struct Trace : sorting::CountingPolicy {
+    vector<int>& arr;
+    bool verbose;
+    Trace(vector<int>& arr) : arr(arr), verbose(arr.size() < 40) {}
+
+    template <typename It>
+    void trace(sorting::SortEvent event, It first, It last, vector<int>::iterator at, vector<int>::iterator) {
+        if (verbose && event == sorting::SortEvent::DIGIT_PASS) {
+            cout << "After digit pass on [" << at - arr.begin() << ", " << at - arr.begin() + (last - first) - 1
+                 << "]: ";
+            printRange(first, last);
+        }
+    }
+};
+
+// Usage: ./radix_sort [digit_bits (8, 11 or 16)] [lsd|msd] [-o sorted.bin] < input
+int main(int argc, char* argv[]) {
+    string output = takeOutputPath(argc, argv);
+    int digitBits = argc >= 2 ? stoi(argv[1]) : sorting::RADIX_DIGIT_BITS;
+    if (digitBits < 1 || digitBits > 16) {
+        cerr << "The digit width must be between 1 and 16 bits!" << endl;
+        return 1;
+    }
+    sorting::RadixMode mode = argc >= 3 && string(argv[2]) == "msd" ? sorting::RadixMode::MSD_IN_PLACE
+                                                                     : sorting::RadixMode::LSD;
+    vector<int> arr = readArray();
+    vector<int> original = arr;
+    int n = arr.size();
+
+    if (n < 40) {
+        cout << "Initial array:" << endl;
+        printArray(original);
+    }
+
+    Trace counter(arr);
+    sorting::radixSort(arr.begin(), arr.end(), digitBits, mode, counter);
+
+    if (n < 40) {
+        cout << "Initial array:" << endl;
+        printArray(original);
+
+        cout << "Sorted array:" << endl;
+        printArray(arr);
+    }
+
+    cout << "Comparisons: " << counter.comparisons << endl;
+    cout << "Swaps: " << counter.swaps << endl;
+    printSortedCheck(arr);
+    if (!writeOutput(output, arr)) {
+        return 1;
+    }
+
+    return 0;
+}
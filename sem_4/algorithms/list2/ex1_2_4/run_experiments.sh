@@ -1,5 +1,8 @@
 #!/bin/bash
 
+# ./bench_harness > experiment_results.csv produces the same file in one process, with
+# fixed seeds and the average wall time and cycles appended (see bench_harness.cpp).
+
 RESULTS_FILE="experiment_results.csv"
 echo "Algorithm,Threshold,n,k,AvgComparisons,AvgSwaps" > $RESULTS_FILE
 
@@ -14,7 +17,7 @@ for k in "${ks[@]}"; do
     for n in $(seq 10 10 50); do
         echo "Running tests for n=$n, k=$k..."
         
-        for algorithm in "insertion_sort" "quick_sort" "dual_pivot_quick_sort"; do
+        for algorithm in "insertion_sort" "quick_sort" "dual_pivot_quick_sort" "radix_sort"; do
             echo "  Running $algorithm..."
             totalComp=0
             totalSwaps=0
@@ -54,7 +57,7 @@ for k in "${ks[@]}"; do
     for n in $(seq 1000 1000 50000); do
         echo "Running tests for large n=$n, k=$k..."
 
-        for algorithm in "quick_sort" "dual_pivot_quick_sort" "hybrid_sort"; do
+        for algorithm in "quick_sort" "dual_pivot_quick_sort" "hybrid_sort" "radix_sort"; do
             echo "  Running $algorithm..."
             totalComp=0
             totalSwaps=0
@@ -0,0 +1,56 @@
+#include <iostream>
+#include <iomanip>
+#include <string>
+#include <chrono>
+#include <algorithm>
+#include "../sorting/sorting.hpp"
+#include "../sorting/array_file.hpp"
+using namespace std;
+
+// Usage: ./sort_file file.bin [intro|quick|dual_pivot|hybrid|merge|radix] [--private]
+// Sorts an array file (see array_file.hpp, written by the generators with --binary) in
+// place through a shared mapping, with no text parsing and no copy, and stores the new
+// checksum. With --private the pages are copy-on-write, so the file stays as it was and
+// can be sorted again, e.g. to time several algorithms on one large input.
+int main(int argc, char* argv[]) {
+    if (argc < 2) {
+        cerr << "Usage: ./sort_file file.bin [intro|quick|dual_pivot|hybrid|merge|radix] [--private]" << endl;
+        return 1;
+    }
+    string algorithm = argc >= 3 ? argv[2] : "intro";
+    bool privateMap = argc >= 4 && string(argv[3]) == "--private";
+
+    sorting::MappedArray<int> arr;
+    if (!arr.open(argv[1], privateMap ? sorting::MapMode::PRIVATE : sorting::MapMode::UPDATE)) {
+        cerr << argv[1] << ": " << arr.error() << endl;
+        return 1;
+    }
+
+    auto start = chrono::steady_clock::now();
+    if (algorithm == "quick") {
+        sorting::quickSort(arr.begin(), arr.end());
+    } else if (algorithm == "dual_pivot") {
+        sorting::dualPivotQuickSort(arr.begin(), arr.end());
+    } else if (algorithm == "hybrid") {
+        sorting::hybridQuickSort(arr.begin(), arr.end());
+    } else if (algorithm == "merge") {
+        sorting::mergeSort(arr.begin(), arr.end());
+    } else if (algorithm == "radix") {
+        sorting::radixSort(arr.begin(), arr.end());
+    } else {
+        sorting::introSort(arr.begin(), arr.end());
+    }
+    double ms = chrono::duration<double, milli>(chrono::steady_clock::now() - start).count();
+
+    if (!is_sorted(arr.begin(), arr.end())) {
+        cerr << "The array is NOT sorted correctly." << endl;
+        return 1;
+    }
+    if (!privateMap && !arr.commit()) {
+        cerr << argv[1] << ": " << arr.error() << endl;
+        return 1;
+    }
+    cout << fixed << setprecision(2) << "Sorted " << arr.size() << " elements in " << ms << " ms" << endl;
+
+    return 0;
+}
@@ -1,8 +1,14 @@
 #include <iostream>
 #include <random>
+#include <string>
+#include <vector>
+#include "../sorting/array_file.hpp"
 
 using namespace std;
 
+// Usage: ./gen_random n [--binary]
+// Prints n random keys from [0, 2n) as "n a_1 ... a_n", or with --binary as an array file
+// (see list2/sorting/array_file.hpp).
 int main(int argc, char* argv[]) {
     if (argc < 2) {
         cerr << "Specify the size of the array!" << endl;
@@ -10,12 +16,21 @@ int main(int argc, char* argv[]) {
     }
 
     int n = stoi(argv[1]);
-    cout << n << endl;
+    bool binary = argc >= 3 && string(argv[2]) == "--binary";
 
     random_device rd;
     mt19937 gen(rd());
     uniform_int_distribution<int> dist(0, 2 * n - 1);
 
+    if (binary) {
+        vector<int> arr(n);
+        for (int& x : arr)
+            x = dist(gen);
+        return sorting::writeArrayFile(cout, arr.data(), arr.size()) ? 0 : 1;
+    }
+
+    cout << n << endl;
+
     for (int i = 0; i < n; i++)
         cout << dist(gen) << " ";
     
@@ -0,0 +1,101 @@
+#include <iostream>
+#include <iomanip>
+#include <vector>
+#include <string>
+#include <random>
+#include <chrono>
+#include <algorithm>
+#include <functional>
+#include <cstdlib>
+#include <new>
+#include "../sorting/merge_sort.hpp"
+#include "../sorting/adaptive_merge_sort.hpp"
+using namespace std;
+
+// Usage: ./merge_alloc_bench [max_n]
+// Heap allocations and wall time of the merge sorts on random input, for n = 10^6, 10^7,
+// ... up to max_n (default 10^7; pass 100000000 for 10^8). "legacy_merge_sort" is the old
+// top-down merge sort, which copied both halves into fresh vectors at every merge. Prints
+// CSV: Algorithm,n,Allocations,AllocatedMB,TimeMs.
+
+// The replacements below pair malloc with free; GCC cannot see that once they are inlined.
+#pragma GCC diagnostic ignored "-Wmismatched-new-delete"
+
+static long long allocations = 0;
+static long long allocatedBytes = 0;
+
+void* operator new(size_t size) {
+    allocations++;
+    allocatedBytes += size;
+    if (void* p = malloc(size == 0 ? 1 : size)) {
+        return p;
+    }
+    throw bad_alloc();
+}
+
+void operator delete(void* p) noexcept {
+    free(p);
+}
+
+void operator delete(void* p, size_t) noexcept {
+    free(p);
+}
+
+void legacyMerge(vector<int>& arr, int left, int mid, int right) {
+    vector<int> leftArr(arr.begin() + left, arr.begin() + mid + 1);
+    vector<int> rightArr(arr.begin() + mid + 1, arr.begin() + right + 1);
+    size_t i = 0, j = 0;
+    int k = left;
+    while (i < leftArr.size() && j < rightArr.size()) {
+        arr[k++] = leftArr[i] <= rightArr[j] ? leftArr[i++] : rightArr[j++];
+    }
+    while (i < leftArr.size()) {
+        arr[k++] = leftArr[i++];
+    }
+    while (j < rightArr.size()) {
+        arr[k++] = rightArr[j++];
+    }
+}
+
+void legacyMergeSort(vector<int>& arr, int left, int right) {
+    if (left < right) {
+        int mid = left + (right - left) / 2;
+        legacyMergeSort(arr, left, mid);
+        legacyMergeSort(arr, mid + 1, right);
+        legacyMerge(arr, left, mid, right);
+    }
+}
+
+void measure(const string& name, const vector<int>& input, const function<void(vector<int>&)>& sort) {
+    vector<int> arr = input;
+    long long allocationsBefore = allocations, bytesBefore = allocatedBytes;
+    auto start = chrono::steady_clock::now();
+    sort(arr);
+    double ms = chrono::duration<double, milli>(chrono::steady_clock::now() - start).count();
+    long long count = allocations - allocationsBefore;
+    double mb = (allocatedBytes - bytesBefore) / (1024.0 * 1024.0);
+    if (!is_sorted(arr.begin(), arr.end())) {
+        cerr << name << ": result is NOT sorted" << endl;
+        exit(1);
+    }
+    cout << name << "," << input.size() << "," << count << "," << mb << "," << ms << endl;
+}
+
+int main(int argc, char* argv[]) {
+    long long maxN = argc >= 2 ? stoll(argv[1]) : 10000000;
+
+    cout << "Algorithm,n,Allocations,AllocatedMB,TimeMs" << endl;
+    cout << fixed << setprecision(2);
+    mt19937 gen(12345);
+    for (long long n = 1000000; n <= maxN; n *= 10) {
+        uniform_int_distribution<int> dist(0, 2 * n - 1);
+        vector<int> input(n);
+        for (int& x : input) {
+            x = dist(gen);
+        }
+        measure("legacy_merge_sort", input, [](vector<int>& a) { legacyMergeSort(a, 0, (int)a.size() - 1); });
+        measure("merge_sort", input, [](vector<int>& a) { sorting::mergeSort(a.begin(), a.end()); });
+        measure("adaptive_merge_sort", input, [](vector<int>& a) { sorting::adaptiveMergeSort(a.begin(), a.end()); });
+    }
+    return 0;
+}
@@ -1,98 +1,60 @@
 #include <iostream>
 #include <vector>
-
+#include "../sorting/merge_sort.hpp"
+#include "../sorting/driver.hpp"
 using namespace std;
 
-int comparison_count = 0;
-
-bool compare(int a, int b) {
-    comparison_count++;  
-    return a <= b;
-}
-
-bool is_sorted(const vector<int>& arr) {
-    for (size_t i = 1; i < arr.size(); i++) {
-        if (arr[i - 1] > arr[i])
-            return false;
-    }
-    return true;
-}
-
-void printArray(const vector<int>& arr) {
-    for (int num : arr) cout << num << " ";
-    cout << endl;
-}
-
-void merge(vector<int>& arr, int left, int mid, int right) {
-    vector<int> leftArr(arr.begin() + left, arr.begin() + mid + 1);
-    vector<int> rightArr(arr.begin() + mid + 1, arr.begin() + right + 1);
-
-    int i = 0, j = 0, k = left;
-
-    while (i < leftArr.size() && j < rightArr.size()) {
-        if (compare(leftArr[i], rightArr[j])) {
-            arr[k++] = leftArr[i++];
-        } else {
-            arr[k++] = rightArr[j++];
+// Counts comparisons; for small inputs also prints every run sorted by the base case and
+// every merged range (it may still sit in the sort's buffer, so only the range itself is
+// printed).
+struct Trace : sorting::CountingPolicy {
+    vector<int>& arr;
+    bool verbose;
+    Trace(vector<int>& arr) : arr(arr), verbose(arr.size() < 40) {}
+
+    template <typename It>
+    void trace(sorting::SortEvent event, It first, It last, vector<int>::iterator at, vector<int>::iterator) {
+        if (!verbose) {
+            return;
         }
-    }
-
-    while (i < leftArr.size()) {
-        arr[k++] = leftArr[i++];
-    }
-
-    while (j < rightArr.size()) {
-        arr[k++] = rightArr[j++];
-    }
-}
-
-void mergeSort(vector<int>& arr, int left, int right, int n) {
-    if (left < right) {
-        int mid = left + (right - left) / 2;
-
-        mergeSort(arr, left, mid, n);
-        mergeSort(arr, mid + 1, right, n);
-
-        merge(arr, left, mid, right);
-
-        if (n < 40) {
-            cout << "After merging [" << left << ", " << right << "]: ";
-            printArray(arr);
+        if (event == sorting::SortEvent::SORTED) {
+            cout << "After base case on [" << first - arr.begin() << ", " << last - arr.begin() - 1 << "]: ";
+            printRange(first, last, 0);
+        } else if (event == sorting::SortEvent::MERGED) {
+            cout << "After merging [" << at - arr.begin() << ", " << at - arr.begin() + (last - first) - 1 << "]: ";
+            printRange(first, last, 0);
         }
     }
-}
-
-int main() {
-    int n;
-    cin >> n;
-    vector<int> arr(n), original(n);
+};
 
-    for (int i = 0; i < n; i++) {
-        cin >> arr[i];
-        original[i] = arr[i];
-    }
+// Usage: ./merge_sort [none|network|insertion] [-o sorted.bin] < input
+// By default there is no base case: the merges start from single elements.
+int main(int argc, char* argv[]) {
+    string output = takeOutputPath(argc, argv);
+    sorting::BaseCase base = parseBaseCase(argc >= 2 ? argv[1] : "none");
+    vector<int> arr = readArray();
+    vector<int> original = arr;
+    int n = arr.size();
 
     if (n < 40) {
         cout << "Initial array:" << endl;
-        printArray(original);
+        printArray(original, 0);
     }
 
-    mergeSort(arr, 0, n - 1, n);
+    Trace counter(arr);
+    sorting::mergeSort(arr.begin(), arr.end(), less<int>(), counter, base);
 
     if (n < 40) {
         cout << "Initial array:" << endl;
-        printArray(original);
-
+        printArray(original, 0);
         cout << "Sorted array:" << endl;
-        printArray(arr);
+        printArray(arr, 0);
     }
 
-    cout << "Comparisons: " << comparison_count << endl;
-
-    if (is_sorted(arr)) {
-        cout << "The array is sorted correctly." << endl;
-    } else {
-        cout << "The array is NOT sorted correctly." << endl;
+    cout << "Comparisons: " << counter.comparisons << endl;
+    printSortedCheck(arr);
+    if (!writeOutput(output, arr)) {
+        return 1;
     }
 
     return 0;
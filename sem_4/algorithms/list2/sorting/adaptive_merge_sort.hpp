@@ -0,0 +1,292 @@
+#ifndef ADAPTIVE_MERGE_SORT_HPP
+#define ADAPTIVE_MERGE_SORT_HPP
+
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <iterator>
+#include <utility>
+#include <vector>
+
+#include "merge_sort.hpp"
+
+namespace sorting {
+
+// A merge switches from element-by-element to galloping after this many wins in a row from
+// the same run (Timsort's MIN_GALLOP); the threshold then adapts during the sort.
+const std::ptrdiff_t MIN_GALLOP = 7;
+
+// Timsort's minimum run length: n itself below 64, otherwise a value in [32, 64] for which
+// n / minRun is just below a power of two, so the runs come out of similar length.
+inline std::ptrdiff_t minRunLength(std::ptrdiff_t n) {
+    std::ptrdiff_t lowBits = 0;
+    while (n >= 64) {
+        lowBits |= n & 1;
+        n >>= 1;
+    }
+    return n + lowBits;
+}
+
+// Sorts [first, last) given that [first, start) is sorted already: each further element is
+// placed by binary search and rotated in. Stable.
+template <typename It, typename Compare, typename Policy>
+void binaryInsertionSort(It first, It start, It last, Compare comp, Policy& policy) {
+    for (It i = start; i != last; ++i) {
+        It pos = std::upper_bound(first, i, *i, [&](const auto& a, const auto& b) {
+            return detail::less(comp, policy, a, b);
+        });
+        std::rotate(pos, i, i + 1);
+    }
+}
+
+// End of the run starting at first: the longest non-descending prefix, or the longest
+// strictly descending one, which is reversed in place (strictness keeps that stable). A
+// run shorter than min(minRun, last - first) is extended to that length by binary
+// insertion.
+template <typename It, typename Compare, typename Policy>
+It nextRun(It first, It last, std::ptrdiff_t minRun, Compare comp, Policy& policy) {
+    It end = first + 1;
+    if (end == last) {
+        return last;
+    }
+    if (detail::less(comp, policy, *end, *first)) {
+        ++end;
+        while (end != last && detail::less(comp, policy, *end, *(end - 1))) {
+            ++end;
+        }
+        std::reverse(first, end);
+    } else {
+        ++end;
+        while (end != last && !detail::less(comp, policy, *end, *(end - 1))) {
+            ++end;
+        }
+    }
+    if (end - first < minRun) {
+        It extended = first + std::min(minRun, last - first);
+        binaryInsertionSort(first, end, extended, comp, policy);
+        end = extended;
+    }
+    return end;
+}
+
+// Splits [first, last) into runs as nextRun() finds them (so descending runs are reversed
+// and, with minRun > 1, short ones extended), as [begin, end) pairs.
+template <typename It, typename Compare, typename Policy>
+std::vector<std::pair<It, It>> findRuns(It first, It last, Compare comp, Policy& policy, std::ptrdiff_t minRun = 1) {
+    std::vector<std::pair<It, It>> runs;
+    for (It start = first; start != last;) {
+        It end = nextRun(start, last, minRun, comp, policy);
+        runs.emplace_back(start, end);
+        start = end;
+    }
+    return runs;
+}
+
+namespace detail {
+
+// Partition point of [first, last) under pred (true on a prefix, false after it), found by
+// exponential search from first, or from last with fromEnd: O(log d) calls of pred when the
+// answer lies d elements from where the search starts.
+template <typename It, typename Pred>
+It gallop(It first, It last, Pred pred, bool fromEnd) {
+    std::ptrdiff_t n = last - first, known = 0, step = 1;
+    if (!fromEnd) {
+        while (step <= n && pred(first[step - 1])) {
+            known = step;
+            step *= 2;
+        }
+        return std::partition_point(first + known, first + std::min(step - 1, n), pred);
+    }
+    while (step <= n && !pred(last[-step])) {
+        known = step;
+        step *= 2;
+    }
+    return std::partition_point(first + std::max<std::ptrdiff_t>(0, n - step + 1), last - known, pred);
+}
+
+// Merges [first, mid) and [mid, last) when the left run is the shorter one: it is moved to
+// buffer and merged with the right run from the front. After minGallop wins in a row by one
+// side, the merge gallops, moving whole blocks found by gallop(), until the blocks get
+// shorter than MIN_GALLOP.
+template <typename It, typename Buf, typename Compare, typename Policy>
+void mergeLow(It first, It mid, It last, Buf buffer, Compare comp, Policy& policy, std::ptrdiff_t& minGallop) {
+    Buf b = buffer, bEnd = std::move(first, mid, buffer);
+    It r = mid, out = first;
+    while (b != bEnd && r != last) {
+        std::ptrdiff_t leftWins = 0, rightWins = 0;
+        while (b != bEnd && r != last && leftWins < minGallop && rightWins < minGallop) {
+            if (less(comp, policy, *r, *b)) {
+                *out++ = std::move(*r++);
+                rightWins++;
+                leftWins = 0;
+            } else {
+                *out++ = std::move(*b++);
+                leftWins++;
+                rightWins = 0;
+            }
+        }
+        while (b != bEnd && r != last) {
+            Buf bStop = gallop(b, bEnd, [&](const auto& x) { return !less(comp, policy, *r, x); }, false);
+            std::ptrdiff_t fromLeft = bStop - b;
+            out = std::move(b, bStop, out);
+            b = bStop;
+            if (b == bEnd) {
+                break;
+            }
+            It rStop = gallop(r, last, [&](const auto& x) { return less(comp, policy, x, *b); }, false);
+            std::ptrdiff_t fromRight = rStop - r;
+            out = std::move(r, rStop, out);
+            r = rStop;
+            if (fromLeft < MIN_GALLOP && fromRight < MIN_GALLOP) {
+                minGallop++;
+                break;
+            }
+            minGallop = std::max<std::ptrdiff_t>(1, minGallop - 1);
+        }
+    }
+    std::move(b, bEnd, out);
+}
+
+// Mirror image of mergeLow() for a shorter right run: it goes to buffer and the merge runs
+// from the back.
+template <typename It, typename Buf, typename Compare, typename Policy>
+void mergeHigh(It first, It mid, It last, Buf buffer, Compare comp, Policy& policy, std::ptrdiff_t& minGallop) {
+    Buf bBegin = buffer, b = std::move(mid, last, buffer);
+    It l = mid, out = last;
+    while (b != bBegin && l != first) {
+        std::ptrdiff_t leftWins = 0, rightWins = 0;
+        while (b != bBegin && l != first && leftWins < minGallop && rightWins < minGallop) {
+            if (less(comp, policy, *(b - 1), *(l - 1))) {
+                *--out = std::move(*--l);
+                leftWins++;
+                rightWins = 0;
+            } else {
+                *--out = std::move(*--b);
+                rightWins++;
+                leftWins = 0;
+            }
+        }
+        while (b != bBegin && l != first) {
+            It lStop = gallop(first, l, [&](const auto& x) { return !less(comp, policy, *(b - 1), x); }, true);
+            std::ptrdiff_t fromLeft = l - lStop;
+            out = std::move_backward(lStop, l, out);
+            l = lStop;
+            if (l == first) {
+                break;
+            }
+            Buf bStop = gallop(bBegin, b, [&](const auto& x) { return less(comp, policy, x, *(l - 1)); }, true);
+            std::ptrdiff_t fromRight = b - bStop;
+            out = std::move_backward(bStop, b, out);
+            b = bStop;
+            if (fromLeft < MIN_GALLOP && fromRight < MIN_GALLOP) {
+                minGallop++;
+                break;
+            }
+            minGallop = std::max<std::ptrdiff_t>(1, minGallop - 1);
+        }
+    }
+    std::move_backward(bBegin, b, out);
+}
+
+// Stable in-place merge of the adjacent runs [first, mid) and [mid, last) using buffer,
+// which holds at least min(mid - first, last - mid) elements. The left run's prefix that
+// is not greater than *mid and the right run's suffix that is not less than *(mid - 1) are
+// already in place and are skipped first.
+template <typename It, typename Buf, typename Compare, typename Policy>
+void mergeRuns(It first, It mid, It last, Buf buffer, Compare comp, Policy& policy, std::ptrdiff_t& minGallop) {
+    first = gallop(first, mid, [&](const auto& x) { return !less(comp, policy, *mid, x); }, false);
+    if (first == mid) {
+        return;
+    }
+    last = gallop(mid, last, [&](const auto& x) { return less(comp, policy, x, *(mid - 1)); }, true);
+    if (mid - first <= last - mid) {
+        mergeLow(first, mid, last, buffer, comp, policy, minGallop);
+    } else {
+        mergeHigh(first, mid, last, buffer, comp, policy, minGallop);
+    }
+}
+
+// Powersort's node power of the boundary between the neighbouring runs [begin1, begin2)
+// and [begin2, end2) of an n-element array: the depth at which a bisection of [0, 1)
+// separates the two runs' midpoints (scaled by 1 / n).
+inline int nodePower(std::ptrdiff_t n, std::ptrdiff_t begin1, std::ptrdiff_t begin2, std::ptrdiff_t end2) {
+    std::ptrdiff_t a = begin1 + begin2, b = begin2 + end2;
+    int power = 0;
+    while (true) {
+        power++;
+        if (a >= n) {
+            a -= n;
+            b -= n;
+        } else if (b >= n) {
+            return power;
+        }
+        a *= 2;
+        b *= 2;
+    }
+}
+
+} // namespace detail
+
+// Powersort: runs are taken left to right with nextRun() (descending ones reversed, short
+// ones extended to minRunLength(n) by binary insertion) and pushed on a stack. Before a run
+// is pushed, every stacked run whose boundary power is above that of the new boundary is
+// merged into it, so the merge tree is nearly optimal for the run lengths and sorting takes
+// O(n + n H) comparisons, H being the entropy of the run lengths. Merges are galloping
+// (see detail::mergeLow); the only allocations are one buffer of n / 2 elements, made on
+// the first merge. Stable.
+template <typename It, typename Compare, typename Policy>
+void adaptiveMergeSort(It first, It last, Compare comp, Policy& policy) {
+    using T = typename std::iterator_traits<It>::value_type;
+    std::ptrdiff_t n = last - first;
+    if (n < 2) {
+        return;
+    }
+    std::ptrdiff_t minRun = minRunLength(n);
+    std::ptrdiff_t minGallop = MIN_GALLOP;
+    std::vector<T> buffer;
+    auto merge = [&](It left, It mid, It right) {
+        if (buffer.empty()) {
+            buffer.assign(first, first + n / 2);
+        }
+        detail::mergeRuns(left, mid, right, buffer.begin(), comp, policy, minGallop);
+        policy.trace(SortEvent::MERGED, left, right, left, left);
+    };
+
+    // Powers on the stack strictly increase from bottom to top and never exceed 64.
+    It stackBegin[65];
+    int stackPower[65];
+    int height = 0;
+
+    It runBegin = first, runEnd = nextRun(first, last, minRun, comp, policy);
+    policy.trace(SortEvent::RUN_FOUND, runBegin, runEnd, runBegin, runBegin);
+    while (runEnd != last) {
+        It nextEnd = nextRun(runEnd, last, minRun, comp, policy);
+        policy.trace(SortEvent::RUN_FOUND, runEnd, nextEnd, runEnd, runEnd);
+        int power = detail::nodePower(n, runBegin - first, runEnd - first, nextEnd - first);
+        while (height > 0 && stackPower[height - 1] > power) {
+            height--;
+            merge(stackBegin[height], runBegin, runEnd);
+            runBegin = stackBegin[height];
+        }
+        stackBegin[height] = runBegin;
+        stackPower[height] = power;
+        height++;
+        runBegin = runEnd;
+        runEnd = nextEnd;
+    }
+    while (height > 0) {
+        height--;
+        merge(stackBegin[height], runBegin, last);
+        runBegin = stackBegin[height];
+    }
+}
+
+template <typename It, typename Compare = std::less<>>
+void adaptiveMergeSort(It first, It last, Compare comp = Compare()) {
+    NoCounting none;
+    adaptiveMergeSort(first, last, comp, none);
+}
+
+} // namespace sorting
+
+#endif // ADAPTIVE_MERGE_SORT_HPP
@@ -0,0 +1,358 @@
+#ifndef ARRAY_FILE_HPP
+#define ARRAY_FILE_HPP
+
+#include <algorithm>
+#include <cerrno>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#if defined(__unix__) || defined(__APPLE__)
+#define SORTING_ARRAY_MMAP
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+// Binary array files, for inputs too large to go through decimal text: a 32-byte header
+//   magic        8 bytes, "SORTARR1"
+//   elementType  uint32, see ElementType
+//   headerSize   uint32, offset of the first element (32)
+//   count        uint64, number of elements
+//   checksum     uint64, arrayChecksum() of the element bytes
+// followed by the elements in native byte order. The generators write it with --binary;
+// everything that reads an array from standard input accepts it as well as the text
+// format "n a_1 ... a_n", and maps it when standard input is a regular file.
+
+namespace sorting {
+
+enum class ElementType : std::uint32_t {
+    INT32 = 1,
+    INT64 = 2,
+    FLOAT32 = 3,
+    FLOAT64 = 4
+};
+
+template <typename T>
+struct ElementTypeOf;
+template <>
+struct ElementTypeOf<std::int32_t> {
+    static constexpr ElementType value = ElementType::INT32;
+};
+template <>
+struct ElementTypeOf<std::int64_t> {
+    static constexpr ElementType value = ElementType::INT64;
+};
+template <>
+struct ElementTypeOf<float> {
+    static constexpr ElementType value = ElementType::FLOAT32;
+};
+template <>
+struct ElementTypeOf<double> {
+    static constexpr ElementType value = ElementType::FLOAT64;
+};
+
+const char ARRAY_FILE_MAGIC[9] = "SORTARR1";
+
+struct ArrayFileHeader {
+    char magic[8];
+    std::uint32_t elementType;
+    std::uint32_t headerSize;
+    std::uint64_t count;
+    std::uint64_t checksum;
+};
+
+static_assert(sizeof(ArrayFileHeader) == 32, "array file header must be 32 bytes");
+
+// FNV-1a over 64-bit words (the tail byte by byte): one multiply per 8 bytes, so checking
+// 10^8 ints costs a small fraction of sorting them.
+inline std::uint64_t arrayChecksum(const void* data, std::size_t bytes) {
+    const unsigned char* p = static_cast<const unsigned char*>(data);
+    const std::uint64_t prime = 1099511628211ull;
+    std::uint64_t h = 14695981039346656037ull;
+    std::size_t i = 0;
+    for (; i + 8 <= bytes; i += 8) {
+        std::uint64_t word;
+        std::memcpy(&word, p + i, 8);
+        h = (h ^ word) * prime;
+    }
+    for (; i < bytes; i++) {
+        h = (h ^ p[i]) * prime;
+    }
+    return h;
+}
+
+template <typename T>
+ArrayFileHeader makeArrayFileHeader(const T* data, std::size_t count) {
+    ArrayFileHeader header;
+    std::memcpy(header.magic, ARRAY_FILE_MAGIC, sizeof(header.magic));
+    header.elementType = static_cast<std::uint32_t>(ElementTypeOf<T>::value);
+    header.headerSize = sizeof(ArrayFileHeader);
+    header.count = count;
+    header.checksum = arrayChecksum(data, count * sizeof(T));
+    return header;
+}
+
+namespace detail {
+
+// Checks everything but the checksum; bytes is the size of the whole file, if known.
+template <typename T>
+bool checkArrayFileHeader(const ArrayFileHeader& header, const std::uint64_t* bytes, std::string& error) {
+    if (std::memcmp(header.magic, ARRAY_FILE_MAGIC, sizeof(header.magic)) != 0) {
+        error = "not an array file";
+        return false;
+    }
+    if (header.elementType != static_cast<std::uint32_t>(ElementTypeOf<T>::value)) {
+        error = "wrong element type " + std::to_string(header.elementType);
+        return false;
+    }
+    if (header.headerSize < sizeof(ArrayFileHeader) || header.headerSize % alignof(T) != 0) {
+        error = "bad header size " + std::to_string(header.headerSize);
+        return false;
+    }
+    // By division: a crafted count could make count * sizeof(T) wrap around.
+    if (bytes != nullptr && (*bytes < header.headerSize || (*bytes - header.headerSize) % sizeof(T) != 0 ||
+                             header.count != (*bytes - header.headerSize) / sizeof(T))) {
+        error = "file size does not match the count of " + std::to_string(header.count) + " elements";
+        return false;
+    }
+    return true;
+}
+
+} // namespace detail
+
+// Writes header and elements to a stream (a pipe, for the generators). Returns false if the
+// stream fails.
+template <typename T>
+bool writeArrayFile(std::ostream& out, const T* data, std::size_t count) {
+    ArrayFileHeader header = makeArrayFileHeader(data, count);
+    out.write(reinterpret_cast<const char*>(&header), sizeof(header));
+    out.write(reinterpret_cast<const char*>(data), count * sizeof(T));
+    out.flush();
+    return static_cast<bool>(out);
+}
+
+// Elements a stream read adds per step. The size of a stream is not known up front, so the
+// array grows only as data actually arrives and a bogus count cannot allocate it all.
+const std::size_t ARRAY_READ_CHUNK = std::size_t(1) << 20;
+
+// Reads an array file from a stream and verifies its checksum.
+template <typename T>
+bool readArrayFile(std::istream& in, std::vector<T>& arr, std::string& error) {
+    ArrayFileHeader header;
+    if (!in.read(reinterpret_cast<char*>(&header), sizeof(header))) {
+        error = "truncated header";
+        return false;
+    }
+    if (!detail::checkArrayFileHeader<T>(header, nullptr, error)) {
+        return false;
+    }
+    if (header.count > arr.max_size()) {
+        error = "count of " + std::to_string(header.count) + " elements is too large";
+        return false;
+    }
+    in.ignore(header.headerSize - sizeof(header));
+    arr.clear();
+    while (arr.size() < header.count) {
+        std::size_t done = arr.size();
+        std::size_t chunk = std::min<std::uint64_t>(ARRAY_READ_CHUNK, header.count - done);
+        arr.resize(done + chunk);
+        if (!in.read(reinterpret_cast<char*>(arr.data() + done), chunk * sizeof(T))) {
+            error = "truncated data";
+            arr.clear();
+            return false;
+        }
+    }
+    if (arrayChecksum(arr.data(), header.count * sizeof(T)) != header.checksum) {
+        error = "checksum mismatch";
+        return false;
+    }
+    return true;
+}
+
+#ifdef SORTING_ARRAY_MMAP
+
+// How MappedArray maps a file:
+//   READ     read-only
+//   PRIVATE  writable copy-on-write pages: sort in place, the file stays as it is
+//   UPDATE   writable shared pages: changes go to the file; commit() fixes the checksum
+enum class MapMode {
+    READ,
+    PRIVATE,
+    UPDATE
+};
+
+// An array file mapped into memory. open() verifies the header and the checksum and
+// reports problems through error().
+template <typename T>
+class MappedArray {
+private:
+    void* base = nullptr;
+    std::size_t length = 0;
+    T* elements = nullptr;
+    std::size_t count = 0;
+    MapMode mapMode = MapMode::READ;
+    std::string message;
+
+public:
+    MappedArray() {}
+    MappedArray(const MappedArray&) = delete;
+    MappedArray& operator=(const MappedArray&) = delete;
+    ~MappedArray() { close(); }
+
+    bool open(const std::string& path, MapMode mode = MapMode::READ) {
+        int fd = ::open(path.c_str(), mode == MapMode::UPDATE ? O_RDWR : O_RDONLY);
+        if (fd < 0) {
+            message = "cannot open " + path + ": " + std::strerror(errno);
+            return false;
+        }
+        bool ok = open(fd, mode);
+        ::close(fd);
+        return ok;
+    }
+
+    // Maps the regular file open as fd (which stays open and owned by the caller), from
+    // its beginning regardless of the descriptor's offset.
+    bool open(int fd, MapMode mode = MapMode::READ) {
+        close();
+        struct stat st;
+        if (fstat(fd, &st) != 0 || !S_ISREG(st.st_mode)) {
+            message = "not a regular file";
+            return false;
+        }
+        length = static_cast<std::size_t>(st.st_size);
+        if (length < sizeof(ArrayFileHeader)) {
+            message = "truncated header";
+            return false;
+        }
+        mapMode = mode;
+        int protection = mode == MapMode::READ ? PROT_READ : PROT_READ | PROT_WRITE;
+        base = mmap(nullptr, length, protection, mode == MapMode::PRIVATE ? MAP_PRIVATE : MAP_SHARED, fd, 0);
+        if (base == MAP_FAILED) {
+            base = nullptr;
+            message = std::string("mmap failed: ") + std::strerror(errno);
+            return false;
+        }
+        const ArrayFileHeader* header = static_cast<const ArrayFileHeader*>(base);
+        std::uint64_t bytes = length;
+        if (!detail::checkArrayFileHeader<T>(*header, &bytes, message)) {
+            close();
+            return false;
+        }
+        elements = reinterpret_cast<T*>(static_cast<char*>(base) + header->headerSize);
+        count = header->count;
+        madvise(base, length, MADV_SEQUENTIAL);
+        if (arrayChecksum(elements, count * sizeof(T)) != header->checksum) {
+            message = "checksum mismatch";
+            close();
+            return false;
+        }
+        return true;
+    }
+
+    // With MapMode::UPDATE: stores the checksum of the current elements and writes the
+    // mapping back to the file.
+    bool commit() {
+        if (base == nullptr || mapMode != MapMode::UPDATE) {
+            message = "not mapped for update";
+            return false;
+        }
+        ArrayFileHeader* header = static_cast<ArrayFileHeader*>(base);
+        header->checksum = arrayChecksum(elements, count * sizeof(T));
+        if (msync(base, length, MS_SYNC) != 0) {
+            message = std::string("msync failed: ") + std::strerror(errno);
+            return false;
+        }
+        return true;
+    }
+
+    void close() {
+        if (base != nullptr) {
+            munmap(base, length);
+        }
+        base = nullptr;
+        elements = nullptr;
+        count = 0;
+    }
+
+    T* data() { return elements; }
+    T* begin() { return elements; }
+    T* end() { return elements + count; }
+    std::size_t size() const { return count; }
+    const std::string& error() const { return message; }
+};
+
+// Creates (or replaces) the array file at path and fills it through a shared mapping.
+template <typename T>
+bool writeArrayFile(const std::string& path, const T* data, std::size_t count, std::string& error) {
+    int fd = ::open(path.c_str(), O_RDWR | O_CREAT | O_TRUNC, 0644);
+    if (fd < 0) {
+        error = "cannot create " + path + ": " + std::strerror(errno);
+        return false;
+    }
+    std::size_t length = sizeof(ArrayFileHeader) + count * sizeof(T);
+    if (ftruncate(fd, static_cast<off_t>(length)) != 0) {
+        error = std::string("cannot resize ") + path + ": " + std::strerror(errno);
+        ::close(fd);
+        return false;
+    }
+    void* base = mmap(nullptr, length, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    ::close(fd);
+    if (base == MAP_FAILED) {
+        error = std::string("mmap failed: ") + std::strerror(errno);
+        return false;
+    }
+    ArrayFileHeader header = makeArrayFileHeader(data, count);
+    std::memcpy(base, &header, sizeof(header));
+    std::memcpy(static_cast<char*>(base) + sizeof(header), data, count * sizeof(T));
+    bool ok = msync(base, length, MS_SYNC) == 0;
+    if (!ok) {
+        error = std::string("msync failed: ") + std::strerror(errno);
+    }
+    munmap(base, length);
+    return ok;
+}
+
+#endif // SORTING_ARRAY_MMAP
+
+// The int array on standard input: an array file (mapped when standard input is a regular
+// file and copied out, streamed otherwise) or the text "n a_1 ... a_n". Exits with a
+// message if an array file is broken.
+inline std::vector<int> readStdinArray() {
+    if (std::cin.peek() == ARRAY_FILE_MAGIC[0]) {
+        std::vector<int> arr;
+        std::string error;
+#ifdef SORTING_ARRAY_MMAP
+        struct stat st;
+        if (fstat(STDIN_FILENO, &st) == 0 && S_ISREG(st.st_mode)) {
+            MappedArray<int> mapped;
+            if (mapped.open(STDIN_FILENO)) {
+                return std::vector<int>(mapped.begin(), mapped.end());
+            }
+            std::cerr << "Invalid array file on standard input: " << mapped.error() << std::endl;
+            std::exit(1);
+        }
+#endif
+        if (!readArrayFile(std::cin, arr, error)) {
+            std::cerr << "Invalid array file on standard input: " << error << std::endl;
+            std::exit(1);
+        }
+        return arr;
+    }
+    int n = 0;
+    std::cin >> n;
+    std::vector<int> arr(n);
+    for (int i = 0; i < n; i++) {
+        std::cin >> arr[i];
+    }
+    return arr;
+}
+
+} // namespace sorting
+
+#endif // ARRAY_FILE_HPP
@@ -0,0 +1,109 @@
+#ifndef DRIVER_HPP
+#define DRIVER_HPP
+
+#include <cstddef>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "array_file.hpp"
+#include "sort_policy.hpp"
+
+// I/O shared by the list2 sorting binaries: read "n a_1 ... a_n" or an array file (see
+// array_file.hpp) from stdin, print arrays for the traces, check the result and write it
+// to an array file if asked to.
+
+inline std::vector<int> readArray() {
+    return sorting::readStdinArray();
+}
+
+// Removes "-o path" from the arguments, so the positional ones keep their places, and
+// returns path ("" without the option).
+inline std::string takeOutputPath(int& argc, char* argv[]) {
+    std::string path;
+    for (int i = 1; i < argc; i++) {
+        if (std::string(argv[i]) == "-o" && i + 1 < argc) {
+            path = argv[i + 1];
+            for (int j = i; j + 2 <= argc; j++) {
+                argv[j] = argv[j + 2];
+            }
+            argc -= 2;
+            break;
+        }
+    }
+    return path;
+}
+
+// Writes the sorted array to path as an array file; nothing for an empty path. Returns
+// false, with a message, if that fails.
+inline bool writeOutput(const std::string& path, const std::vector<int>& arr) {
+    if (path.empty()) {
+        return true;
+    }
+    std::string error;
+#ifdef SORTING_ARRAY_MMAP
+    bool ok = sorting::writeArrayFile(path, arr.data(), arr.size(), error);
+#else
+    std::ofstream out(path, std::ios::binary);
+    bool ok = sorting::writeArrayFile(out, arr.data(), arr.size());
+    error = "cannot write " + path;
+#endif
+    if (!ok) {
+        std::cerr << error << std::endl;
+    }
+    return ok;
+}
+
+template <typename It>
+void printRange(It first, It last, int width = 2) {
+    for (It it = first; it != last; ++it) {
+        std::cout << std::setw(width) << *it << " ";
+    }
+    std::cout << std::endl;
+}
+
+inline void printArray(const std::vector<int>& arr, int width = 2) {
+    printRange(arr.begin(), arr.end(), width);
+}
+
+inline bool is_sorted(const std::vector<int>& arr) {
+    for (std::size_t i = 1; i < arr.size(); i++) {
+        if (arr[i - 1] > arr[i])
+            return false;
+    }
+    return true;
+}
+
+inline void printSortedCheck(const std::vector<int>& arr) {
+    if (is_sorted(arr)) {
+        std::cout << "The array is sorted correctly." << std::endl;
+    } else {
+        std::cout << "The array is NOT sorted correctly." << std::endl;
+    }
+}
+
+// "block" and "simd" select those partition schemes; anything else means Lomuto.
+inline sorting::PartitionScheme parseScheme(const std::string& name) {
+    if (name == "block") {
+        return sorting::PartitionScheme::BLOCK;
+    }
+    if (name == "simd") {
+        return sorting::PartitionScheme::SIMD;
+    }
+    return sorting::PartitionScheme::LOMUTO;
+}
+
+// "network" and "insertion" select those base cases; anything else means none.
+inline sorting::BaseCase parseBaseCase(const std::string& name) {
+    if (name == "network") {
+        return sorting::BaseCase::NETWORK;
+    }
+    if (name == "insertion") {
+        return sorting::BaseCase::INSERTION;
+    }
+    return sorting::BaseCase::NONE;
+}
+
+#endif // DRIVER_HPP
@@ -0,0 +1,145 @@
+#ifndef DUAL_PIVOT_QUICK_SORT_HPP
+#define DUAL_PIVOT_QUICK_SORT_HPP
+
+#include <climits>
+#include <cstddef>
+#include <functional>
+
+#include "simd_partition.hpp"
+#include "sort_policy.hpp"
+#include "sorting_network.hpp"
+
+namespace sorting {
+
+// Default for the largest range that goes to the base case.
+const std::ptrdiff_t DUAL_PIVOT_BASE_SIZE = 16;
+
+namespace detail {
+
+// Swaps of an element with itself are skipped and not counted.
+template <typename It, typename Policy>
+inline void swap_distinct(Policy& policy, It a, It b) {
+    if (a != b) {
+        swap_at(policy, a, b);
+    }
+}
+
+} // namespace detail
+
+// Count-based dual-pivot partition: p = min(first, last - 1), q = the other one. Each
+// element is compared first against the pivot whose class has been larger so far, which
+// saves comparisons on average. On return [first, lp) < p, [lp + 1, rp) is between the
+// pivots and [rp + 1, last) > q.
+template <typename It, typename Compare, typename Policy>
+void dualPivotPartition(It first, It last, It& lp, It& rp, Compare comp, Policy& policy) {
+    It low = first;
+    It high = last - 1;
+    if (detail::less(comp, policy, *high, *low)) {
+        detail::swap_distinct(policy, low, high);
+    }
+    // The pivots stay at low and high until the final swaps below.
+    const auto& p = *low;
+    const auto& q = *high;
+    It lt = low + 1, gt = high - 1, i = low + 1;
+    std::ptrdiff_t small_count = 0, large_count = 0;
+    while (i <= gt) {
+        if (large_count > small_count) {
+            if (detail::less(comp, policy, q, *i)) {
+                detail::swap_distinct(policy, i, gt);
+                --gt;
+                large_count++;
+                continue;
+            } else if (detail::less(comp, policy, *i, p)) {
+                detail::swap_distinct(policy, i, lt);
+                ++lt;
+                small_count++;
+            }
+        } else {
+            if (detail::less(comp, policy, *i, p)) {
+                detail::swap_distinct(policy, i, lt);
+                ++lt;
+                small_count++;
+            } else if (detail::less(comp, policy, q, *i)) {
+                detail::swap_distinct(policy, i, gt);
+                --gt;
+                large_count++;
+                continue;
+            }
+        }
+        ++i;
+    }
+    detail::swap_distinct(policy, low, --lt);
+    detail::swap_distinct(policy, high, ++gt);
+    lp = lt;
+    rp = gt;
+}
+
+// Same contract and pivots as dualPivotPartition(), for contiguous ints under std::less: two
+// passes of simdPartition(), first splitting off the keys below p, then those above q from
+// the rest. Counts one comparison per key and pass and no swaps except the pivots'. Other
+// ranges fall back to dualPivotPartition().
+template <typename It, typename Compare, typename Policy>
+void vectorDualPivotPartition(It first, It last, It& lp, It& rp, Compare comp, Policy& policy) {
+    if constexpr (detail::is_simd_partitionable<It, Compare>::value) {
+        int* low = &*first;
+        int* high = low + (last - first) - 1;
+        if (detail::less(comp, policy, *high, *low)) {
+            detail::swap_at(policy, low, high);
+        }
+        int p = *low, q = *high;
+        int* m1 = simdPartition(low + 1, high, p);
+        int* m2 = q == INT_MAX ? high : simdPartition(m1, high, q + 1);
+        std::ptrdiff_t compared = (high - low - 1) + (high - m1);
+        for (std::ptrdiff_t i = 0; i < compared; i++) {
+            policy.count_comparison();
+        }
+        lp = first + (m1 - 1 - low);
+        rp = first + (m2 - low);
+        detail::swap_distinct(policy, first, lp);
+        detail::swap_distinct(policy, last - 1, rp);
+    } else {
+        dualPivotPartition(first, last, lp, rp, comp, policy);
+    }
+}
+
+// Ranges of at most baseSize elements go to the base case; with BaseCase::NONE the
+// recursion goes down to single elements.
+template <typename It, typename Compare, typename Policy>
+void dualPivotQuickSort(It first, It last, Compare comp, Policy& policy, PartitionScheme scheme = PartitionScheme::LOMUTO,
+                        BaseCase base = BaseCase::NETWORK, std::ptrdiff_t baseSize = DUAL_PIVOT_BASE_SIZE) {
+    if (last - first < 2) {
+        return;
+    }
+    if (base != BaseCase::NONE && last - first <= baseSize) {
+        detail::baseCaseSort(first, last, base, comp, policy);
+        policy.trace(SortEvent::SORTED, first, last, last, last);
+        return;
+    }
+    It lp, rp;
+    if (scheme == PartitionScheme::SIMD) {
+        vectorDualPivotPartition(first, last, lp, rp, comp, policy);
+    } else {
+        dualPivotPartition(first, last, lp, rp, comp, policy);
+    }
+    policy.trace(SortEvent::PARTITIONED, first, last, lp, rp);
+    if (lp > first) {
+        dualPivotQuickSort(first, lp, comp, policy, scheme, base, baseSize);
+    }
+    if (lp + 1 < rp) {
+        dualPivotQuickSort(lp + 1, rp, comp, policy, scheme, base, baseSize);
+    }
+    if (rp + 1 < last) {
+        dualPivotQuickSort(rp + 1, last, comp, policy, scheme, base, baseSize);
+    }
+    policy.trace(SortEvent::SORTED, first, last, last, last);
+}
+
+template <typename It, typename Compare = std::less<>>
+void dualPivotQuickSort(It first, It last, Compare comp = Compare()) {
+    NoCounting none;
+    dualPivotQuickSort(first, last, comp, none);
+}
+
+} // namespace sorting
+
+#endif // DUAL_PIVOT_QUICK_SORT_HPP
@@ -0,0 +1,56 @@
+#ifndef HEAP_SORT_HPP
+#define HEAP_SORT_HPP
+
+#include <cstddef>
+#include <functional>
+
+#include "sort_policy.hpp"
+
+namespace sorting {
+
+namespace detail {
+
+// Restores the max-heap property below index i of the heap first[0, n).
+template <typename It, typename Compare, typename Policy>
+void siftDown(It first, std::ptrdiff_t i, std::ptrdiff_t n, Compare comp, Policy& policy) {
+    while (true) {
+        std::ptrdiff_t child = 2 * i + 1;
+        if (child >= n) {
+            return;
+        }
+        if (child + 1 < n && less(comp, policy, first[child], first[child + 1])) {
+            child++;
+        }
+        if (!less(comp, policy, first[i], first[child])) {
+            return;
+        }
+        swap_at(policy, first + i, first + child);
+        i = child;
+    }
+}
+
+} // namespace detail
+
+// Builds a max-heap bottom-up, then swaps the maximum behind the shrinking heap. O(n log n)
+// on every input, in place, not stable.
+template <typename It, typename Compare, typename Policy>
+void heapSort(It first, It last, Compare comp, Policy& policy) {
+    std::ptrdiff_t n = last - first;
+    for (std::ptrdiff_t i = n / 2 - 1; i >= 0; i--) {
+        detail::siftDown(first, i, n, comp, policy);
+    }
+    for (std::ptrdiff_t end = n - 1; end > 0; end--) {
+        detail::swap_at(policy, first, first + end);
+        detail::siftDown(first, 0, end, comp, policy);
+    }
+}
+
+template <typename It, typename Compare = std::less<>>
+void heapSort(It first, It last, Compare comp = Compare()) {
+    NoCounting none;
+    heapSort(first, last, comp, none);
+}
+
+} // namespace sorting
+
+#endif // HEAP_SORT_HPP
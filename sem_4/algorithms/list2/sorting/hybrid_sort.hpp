@@ -0,0 +1,40 @@
+#ifndef HYBRID_SORT_HPP
+#define HYBRID_SORT_HPP
+
+#include <functional>
+
+#include "quick_sort.hpp"
+#include "sorting_network.hpp"
+
+namespace sorting {
+
+const int HYBRID_THRESHOLD = 10;
+
+// Quicksort that hands ranges of at most threshold + 1 elements to the base case: the
+// sorting network for their size, or insertion sort (always, past MAX_NETWORK_SIZE).
+template <typename It, typename Compare, typename Policy>
+void hybridQuickSort(It first, It last, int threshold, Compare comp, Policy& policy,
+                     PartitionScheme scheme = PartitionScheme::LOMUTO, BaseCase base = BaseCase::NETWORK) {
+    if (last - first < 2) {
+        return;
+    }
+    if (last - first - 1 < threshold) {
+        detail::baseCaseSort(first, last, base, comp, policy);
+        policy.trace(SortEvent::SORTED, first, last, last, last);
+        return;
+    }
+    It p = partition(first, last, scheme, comp, policy);
+    policy.trace(SortEvent::PARTITIONED, first, last, p, p);
+    hybridQuickSort(first, p, threshold, comp, policy, scheme, base);
+    hybridQuickSort(p + 1, last, threshold, comp, policy, scheme, base);
+}
+
+template <typename It, typename Compare = std::less<>>
+void hybridQuickSort(It first, It last, int threshold = HYBRID_THRESHOLD, Compare comp = Compare()) {
+    NoCounting none;
+    hybridQuickSort(first, last, threshold, comp, none);
+}
+
+} // namespace sorting
+
+#endif // HYBRID_SORT_HPP
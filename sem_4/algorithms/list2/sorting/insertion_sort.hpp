@@ -0,0 +1,34 @@
+#ifndef INSERTION_SORT_HPP
+#define INSERTION_SORT_HPP
+
+#include <functional>
+
+#include "sort_policy.hpp"
+
+namespace sorting {
+
+// Sinks each element into the sorted prefix by adjacent swaps.
+template <typename It, typename Compare, typename Policy>
+void insertionSort(It first, It last, Compare comp, Policy& policy) {
+    if (last - first < 2) {
+        return;
+    }
+    for (It i = first + 1; i != last; ++i) {
+        It j = i;
+        while (j != first && detail::less(comp, policy, *j, *(j - 1))) {
+            detail::swap_at(policy, j, j - 1);
+            --j;
+        }
+        policy.trace(SortEvent::INSERTION_PASS, first, last, i, i);
+    }
+}
+
+template <typename It, typename Compare = std::less<>>
+void insertionSort(It first, It last, Compare comp = Compare()) {
+    NoCounting none;
+    insertionSort(first, last, comp, none);
+}
+
+} // namespace sorting
+
+#endif // INSERTION_SORT_HPP
@@ -0,0 +1,224 @@
+#ifndef INTRO_SORT_HPP
+#define INTRO_SORT_HPP
+
+#include <cstddef>
+#include <functional>
+#include <utility>
+
+#include "heap_sort.hpp"
+#include "insertion_sort.hpp"
+#include "sort_policy.hpp"
+
+namespace sorting {
+
+// Ranges below this size go to insertion sort.
+const std::ptrdiff_t INTRO_INSERTION_THRESHOLD = 24;
+// Ranges above this size take the ninther (median of three medians of three) as the pivot.
+const std::ptrdiff_t INTRO_NINTHER_THRESHOLD = 128;
+// The partial insertion sort gives up after this many element moves.
+const std::ptrdiff_t PARTIAL_INSERTION_LIMIT = 8;
+
+namespace detail {
+
+template <typename It, typename Compare, typename Policy>
+void sort2(It a, It b, Compare comp, Policy& policy) {
+    if (less(comp, policy, *b, *a)) {
+        swap_at(policy, a, b);
+    }
+}
+
+template <typename It, typename Compare, typename Policy>
+void sort3(It a, It b, It c, Compare comp, Policy& policy) {
+    sort2(a, b, comp, policy);
+    sort2(b, c, comp, policy);
+    sort2(a, b, comp, policy);
+}
+
+// Insertion sort that gives up, returning false, once more than PARTIAL_INSERTION_LIMIT
+// element moves were needed; cheap proof that a range is (nearly) sorted.
+template <typename It, typename Compare, typename Policy>
+bool partialInsertionSort(It first, It last, Compare comp, Policy& policy) {
+    if (first == last) {
+        return true;
+    }
+    std::ptrdiff_t moves = 0;
+    for (It i = first + 1; i != last; ++i) {
+        It j = i;
+        while (j != first && less(comp, policy, *j, *(j - 1))) {
+            swap_at(policy, j, j - 1);
+            --j;
+            moves++;
+        }
+        if (moves > PARTIAL_INSERTION_LIMIT) {
+            return false;
+        }
+    }
+    return true;
+}
+
+// Hoare-style partition around the pivot at first, with the elements equal to it going
+// right. Needs an element not less than the pivot after first (the pivot selection leaves
+// one at last - 1). Returns the pivot's final position and whether the range was already
+// partitioned (no swaps needed).
+template <typename It, typename Compare, typename Policy>
+std::pair<It, bool> partitionRight(It first, It last, Compare comp, Policy& policy) {
+    It l = first, r = last;
+    while (less(comp, policy, *++l, *first)) {
+    }
+    if (l - 1 == first) {
+        while (l < r && !less(comp, policy, *--r, *first)) {
+        }
+    } else {
+        while (!less(comp, policy, *--r, *first)) {
+        }
+    }
+    bool alreadyPartitioned = l >= r;
+    while (l < r) {
+        swap_at(policy, l, r);
+        while (less(comp, policy, *++l, *first)) {
+        }
+        while (!less(comp, policy, *--r, *first)) {
+        }
+    }
+    It pivot = l - 1;
+    if (pivot != first) {
+        swap_at(policy, first, pivot);
+    }
+    return std::make_pair(pivot, alreadyPartitioned);
+}
+
+// Partition around the pivot at first with the elements equal to it going left. Used when
+// the element before the range equals the pivot: then nothing in the range is smaller, so
+// [first, returned position] holds only copies of the pivot and needs no further sorting.
+template <typename It, typename Compare, typename Policy>
+It partitionLeft(It first, It last, Compare comp, Policy& policy) {
+    It l = first, r = last;
+    while (less(comp, policy, *first, *--r)) {
+    }
+    if (r + 1 == last) {
+        while (l < r && !less(comp, policy, *first, *++l)) {
+        }
+    } else {
+        while (!less(comp, policy, *first, *++l)) {
+        }
+    }
+    while (l < r) {
+        swap_at(policy, l, r);
+        while (less(comp, policy, *first, *--r)) {
+        }
+        while (!less(comp, policy, *first, *++l)) {
+        }
+    }
+    if (r != first) {
+        swap_at(policy, first, r);
+    }
+    return r;
+}
+
+// Swaps a few elements of [first, last) with ones a quarter of the way in, to break up
+// the pattern that made the last partition unbalanced.
+template <typename It, typename Policy>
+void breakPatterns(It first, It last, Policy& policy) {
+    std::ptrdiff_t n = last - first;
+    if (n < INTRO_INSERTION_THRESHOLD) {
+        return;
+    }
+    swap_at(policy, first, first + n / 4);
+    swap_at(policy, last - 1, last - n / 4);
+    if (n > INTRO_NINTHER_THRESHOLD) {
+        swap_at(policy, first + 1, first + (n / 4 + 1));
+        swap_at(policy, first + 2, first + (n / 4 + 2));
+        swap_at(policy, last - 2, last - (n / 4 + 1));
+        swap_at(policy, last - 3, last - (n / 4 + 2));
+    }
+}
+
+template <typename It, typename Compare, typename Policy>
+void introSortLoop(It first, It last, int badAllowed, bool leftmost, Compare comp, Policy& policy) {
+    while (true) {
+        std::ptrdiff_t n = last - first;
+        if (n < INTRO_INSERTION_THRESHOLD) {
+            insertionSort(first, last, comp, policy);
+            policy.trace(SortEvent::SORTED, first, last, last, last);
+            return;
+        }
+
+        // Pivot to first, and an element not less than it to last - 1.
+        std::ptrdiff_t half = n / 2;
+        if (n > INTRO_NINTHER_THRESHOLD) {
+            sort3(first, first + half, last - 1, comp, policy);
+            sort3(first + 1, first + (half - 1), last - 2, comp, policy);
+            sort3(first + 2, first + (half + 1), last - 3, comp, policy);
+            sort3(first + (half - 1), first + half, first + (half + 1), comp, policy);
+            swap_at(policy, first, first + half);
+        } else {
+            sort3(first + half, first, last - 1, comp, policy);
+        }
+
+        // Equal to the element before the range: that is a run of duplicates, which the left
+        // partition removes in one go.
+        if (!leftmost && !less(comp, policy, *(first - 1), *first)) {
+            It p = partitionLeft(first, last, comp, policy);
+            policy.trace(SortEvent::PARTITIONED, first, last, p, p);
+            first = p + 1;
+            continue;
+        }
+
+        std::pair<It, bool> split = partitionRight(first, last, comp, policy);
+        It p = split.first;
+        policy.trace(SortEvent::PARTITIONED, first, last, p, p);
+        std::ptrdiff_t leftSize = p - first, rightSize = last - (p + 1);
+        if (leftSize < n / 8 || rightSize < n / 8) {
+            if (--badAllowed == 0) {
+                heapSort(first, last, comp, policy);
+                policy.trace(SortEvent::SORTED, first, last, last, last);
+                return;
+            }
+            breakPatterns(first, p, policy);
+            breakPatterns(p + 1, last, policy);
+        } else if (split.second && partialInsertionSort(first, p, comp, policy) &&
+                   partialInsertionSort(p + 1, last, comp, policy)) {
+            policy.trace(SortEvent::SORTED, first, last, last, last);
+            return;
+        }
+
+        // Recursing into the smaller side keeps the stack O(log n).
+        if (leftSize < rightSize) {
+            introSortLoop(first, p, badAllowed, leftmost, comp, policy);
+            first = p + 1;
+            leftmost = false;
+        } else {
+            introSortLoop(p + 1, last, badAllowed, false, comp, policy);
+            last = p;
+        }
+    }
+}
+
+} // namespace detail
+
+// Pattern-defeating quicksort (Peters' pdqsort): median-of-3 pivots, or the ninther on
+// ranges above INTRO_NINTHER_THRESHOLD; runs of equal keys removed by partitionLeft;
+// ranges that came out of a partition untouched checked with a bounded insertion sort;
+// unbalanced partitions answered by shuffling a few elements and, after log2(n) of them,
+// by heapsort. O(n log n) on every input and O(n) on sorted, reversed or all-equal input,
+// with O(log n) stack. Not stable.
+template <typename It, typename Compare, typename Policy>
+void introSort(It first, It last, Compare comp, Policy& policy) {
+    std::ptrdiff_t n = last - first;
+    int log2 = 0;
+    while (n > 1) {
+        n >>= 1;
+        log2++;
+    }
+    detail::introSortLoop(first, last, log2, true, comp, policy);
+}
+
+template <typename It, typename Compare = std::less<>>
+void introSort(It first, It last, Compare comp = Compare()) {
+    NoCounting none;
+    introSort(first, last, comp, none);
+}
+
+} // namespace sorting
+
+#endif // INTRO_SORT_HPP
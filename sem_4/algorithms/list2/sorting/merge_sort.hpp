@@ -0,0 +1,160 @@
+#ifndef MERGE_SORT_HPP
+#define MERGE_SORT_HPP
+
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <iterator>
+#include <vector>
+
+#include "sort_policy.hpp"
+#include "sorting_network.hpp"
+
+namespace sorting {
+
+// Array plus buffer bytes that one tile of the bottom-up merge sort may touch; chosen to
+// stay inside a typical L2 cache.
+const std::size_t MERGE_TILE_BYTES = 512 * 1024;
+// Largest run the base case sorts before the first merge pass (up to twice that, see
+// bottomUpMergeSort).
+const std::ptrdiff_t MERGE_BASE_SIZE = 16;
+
+// Stable merge of the sorted ranges [first1, last1) and [first2, last2) into out; on ties
+// the element of the first range goes first. One comparison is counted per element placed
+// while both ranges last.
+template <typename It1, typename It2, typename Out, typename Compare, typename Policy>
+Out mergeInto(It1 first1, It1 last1, It2 first2, It2 last2, Out out, Compare comp, Policy& policy) {
+    while (first1 != last1 && first2 != last2) {
+        if (!detail::less(comp, policy, *first2, *first1)) {
+            *out++ = *first1++;
+        } else {
+            *out++ = *first2++;
+        }
+    }
+    out = std::copy(first1, last1, out);
+    return std::copy(first2, last2, out);
+}
+
+namespace detail {
+
+// One bottom-up pass: with the array cut into 2^level sorted runs whose boundaries are
+// i * n / 2^level, merges the run pairs (2i, 2i + 1) for i in [pairBegin, pairEnd) from src
+// into dst. array is the caller's array, for the trace. (i * n must fit in ptrdiff_t, so
+// n stays below 2^31 on 64-bit targets.)
+template <typename Src, typename Dst, typename It, typename Compare, typename Policy>
+void mergePass(Src src, Dst dst, It array, std::ptrdiff_t n, int level, std::ptrdiff_t pairBegin,
+               std::ptrdiff_t pairEnd, Compare comp, Policy& policy) {
+    std::ptrdiff_t right = (2 * pairBegin * n) >> level;
+    for (std::ptrdiff_t i = pairBegin; i < pairEnd; i++) {
+        std::ptrdiff_t left = right;
+        std::ptrdiff_t mid = ((2 * i + 1) * n) >> level;
+        right = ((2 * i + 2) * n) >> level;
+        mergeInto(src + left, src + mid, src + mid, src + right, dst + left, comp, policy);
+        if (left < mid && mid < right) {
+            policy.trace(SortEvent::MERGED, dst + left, dst + right, array + left, array + left);
+        }
+    }
+}
+
+// Bottom-up merge sort of [first, first + n) with buffer[0, n) as scratch. It starts from
+// the 2^levels runs with boundaries i * n / 2^levels, sorted by the base case, and pass k
+// merges the runs at level levels - k + 1 pairwise. That is the balanced merge tree of the
+// top-down sort, so no merge is lopsided when n is not a power of two.
+//
+// The runs hold at most MERGE_BASE_SIZE elements, or twice that when one level fewer gives
+// an even number of passes: each pass moves the data to the other array, so the result then
+// lands in [first, first + n). The base case is the sorting network only for keys whose ties
+// cannot be told apart (see has_indistinguishable_ties), since the network is not stable; it
+// is insertion sort otherwise. With BaseCase::NONE the runs hold one element, or two that
+// are put in order by one compare-exchange, counted and traced as a merge. The first passes
+// run tile by tile, each tile (array part plus buffer part) fitting in MERGE_TILE_BYTES, so
+// it is sorted while it is still in cache.
+template <typename It, typename Buf, typename Compare, typename Policy>
+void bottomUpMergeSort(It first, std::ptrdiff_t n, Buf buffer, Compare comp, Policy& policy,
+                       BaseCase base = BaseCase::NETWORK) {
+    if (n < 2) {
+        return;
+    }
+    using T = typename std::iterator_traits<It>::value_type;
+    if (base == BaseCase::NETWORK && !has_indistinguishable_ties<It, Compare>::value) {
+        base = BaseCase::INSERTION;
+    }
+    std::ptrdiff_t baseSize = base == BaseCase::NONE ? 1 : MERGE_BASE_SIZE;
+    int levels = 0;
+    while (((n - 1) >> levels) + 1 > baseSize) {
+        levels++;
+    }
+    if (levels % 2 == 1) {
+        levels--;
+    }
+    std::ptrdiff_t maxRun = ((n - 1) >> levels) + 1;
+    std::ptrdiff_t maxTile = std::max<std::ptrdiff_t>(2, MERGE_TILE_BYTES / (2 * sizeof(T)));
+    int tilePasses = 0;
+    while (tilePasses < levels && (maxRun << (tilePasses + 1)) <= maxTile) {
+        tilePasses++;
+    }
+
+    std::ptrdiff_t tiles = std::ptrdiff_t(1) << (levels - tilePasses);
+    for (std::ptrdiff_t t = 0; t < tiles; t++) {
+        std::ptrdiff_t runs = std::ptrdiff_t(1) << tilePasses;
+        for (std::ptrdiff_t i = t * runs; i < (t + 1) * runs; i++) {
+            std::ptrdiff_t left = (i * n) >> levels, right = ((i + 1) * n) >> levels;
+            if (right - left > 1 && base == BaseCase::NONE) {
+                if (less(comp, policy, first[left + 1], first[left])) {
+                    std::iter_swap(first + left, first + left + 1);
+                }
+                policy.trace(SortEvent::MERGED, first + left, first + right, first + left, first + left);
+            } else if (right - left > 1) {
+                baseCaseSort(first + left, first + right, base, comp, policy);
+                policy.trace(SortEvent::SORTED, first + left, first + right, first + right, first + right);
+            }
+        }
+        bool inBuffer = false;
+        for (int k = 1; k <= tilePasses; k++) {
+            int level = levels - k + 1;
+            std::ptrdiff_t pairs = std::ptrdiff_t(1) << (tilePasses - k);
+            if (inBuffer) {
+                mergePass(buffer, first, first, n, level, t * pairs, (t + 1) * pairs, comp, policy);
+            } else {
+                mergePass(first, buffer, first, n, level, t * pairs, (t + 1) * pairs, comp, policy);
+            }
+            inBuffer = !inBuffer;
+        }
+    }
+
+    bool inBuffer = tilePasses % 2 == 1;
+    for (int k = tilePasses + 1; k <= levels; k++) {
+        int level = levels - k + 1;
+        std::ptrdiff_t pairs = std::ptrdiff_t(1) << (level - 1);
+        if (inBuffer) {
+            mergePass(buffer, first, first, n, level, 0, pairs, comp, policy);
+        } else {
+            mergePass(first, buffer, first, n, level, 0, pairs, comp, policy);
+        }
+        inBuffer = !inBuffer;
+    }
+}
+
+} // namespace detail
+
+// Bottom-up merge sort with one scratch buffer of n elements, allocated once per call.
+// Stable.
+template <typename It, typename Compare, typename Policy>
+void mergeSort(It first, It last, Compare comp, Policy& policy, BaseCase base = BaseCase::NETWORK) {
+    if (last - first < 2) {
+        return;
+    }
+    using T = typename std::iterator_traits<It>::value_type;
+    std::vector<T> buffer(first, last);
+    detail::bottomUpMergeSort(first, last - first, buffer.begin(), comp, policy, base);
+}
+
+template <typename It, typename Compare = std::less<>>
+void mergeSort(It first, It last, Compare comp = Compare()) {
+    NoCounting none;
+    mergeSort(first, last, comp, none);
+}
+
+} // namespace sorting
+
+#endif // MERGE_SORT_HPP
@@ -0,0 +1,186 @@
+#ifndef PARALLEL_MERGE_SORT_HPP
+#define PARALLEL_MERGE_SORT_HPP
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <functional>
+#include <iterator>
+#include <utility>
+#include <vector>
+
+#include "adaptive_merge_sort.hpp"
+#include "merge_sort.hpp"
+#include "task_pool.hpp"
+
+namespace sorting {
+
+// Merge path co-ranking: the first k elements of the stable merge of a[0, na) and b[0, nb)
+// are a[0, i) and b[0, k - i); returns that i. O(log min(k, na)) comparisons.
+template <typename It1, typename It2, typename Compare>
+std::ptrdiff_t coRank(std::ptrdiff_t k, It1 a, std::ptrdiff_t na, It2 b, std::ptrdiff_t nb, Compare comp) {
+    std::ptrdiff_t lo = std::max<std::ptrdiff_t>(0, k - nb);
+    std::ptrdiff_t hi = std::min(k, na);
+    while (lo < hi) {
+        std::ptrdiff_t i = lo + (hi - lo) / 2;
+        // a[i] still belongs to the first k if it does not come after b[k - i - 1].
+        if (!comp(b[k - i - 1], a[i])) {
+            lo = i + 1;
+        } else {
+            hi = i;
+        }
+    }
+    return lo;
+}
+
+// Stable merge of [first1, last1) and [first2, last2) into out. The output is cut into
+// pieces of about options.cutoff elements (at most one per worker); coRank() finds where
+// each piece starts in both inputs, so the pieces are merged independently.
+template <typename It1, typename It2, typename Out, typename Compare>
+void parallelMerge(TaskPool& pool, It1 first1, It1 last1, It2 first2, It2 last2, Out out, Compare comp,
+                   const ParallelOptions& options) {
+    std::ptrdiff_t na = last1 - first1, nb = last2 - first2, n = na + nb;
+    std::ptrdiff_t pieces = std::min<std::ptrdiff_t>(pool.size(), std::max<std::ptrdiff_t>(1, n / options.cutoff));
+    if (pieces == 1) {
+        std::merge(first1, last1, first2, last2, out, comp);
+        return;
+    }
+    std::atomic<long> pending(pieces);
+    for (std::ptrdiff_t p = 0; p < pieces; p++) {
+        pool.spawn([=, &pending] {
+            std::ptrdiff_t k0 = n * p / pieces, k1 = n * (p + 1) / pieces;
+            std::ptrdiff_t i0 = coRank(k0, first1, na, first2, nb, comp);
+            std::ptrdiff_t i1 = coRank(k1, first1, na, first2, nb, comp);
+            std::merge(first1 + i0, first1 + i1, first2 + (k0 - i0), first2 + (k1 - i1), out + k0, comp);
+            pending.fetch_sub(1, std::memory_order_acq_rel);
+        });
+    }
+    pool.wait(pending);
+}
+
+template <typename It, typename Out>
+void parallelCopy(TaskPool& pool, It first, It last, Out out, const ParallelOptions& options) {
+    std::ptrdiff_t n = last - first;
+    std::ptrdiff_t pieces = std::min<std::ptrdiff_t>(pool.size(), std::max<std::ptrdiff_t>(1, n / options.cutoff));
+    std::atomic<long> pending(pieces);
+    for (std::ptrdiff_t p = 0; p < pieces; p++) {
+        pool.spawn([=, &pending] {
+            std::copy(first + n * p / pieces, first + n * (p + 1) / pieces, out + n * p / pieces);
+            pending.fetch_sub(1, std::memory_order_acq_rel);
+        });
+    }
+    pool.wait(pending);
+}
+
+namespace detail {
+
+// Sorts [first, last); the result goes to [first, last) or, with intoBuffer, to
+// [buffer, buffer + n). Children sort into the other array, so the two alternate between
+// levels and nothing is copied back except at the leaves.
+template <typename It, typename Buf, typename Compare>
+void parallelMergeSortTask(TaskPool& pool, It first, It last, Buf buffer, bool intoBuffer, Compare comp,
+                           const ParallelOptions& options) {
+    std::ptrdiff_t n = last - first;
+    if (n < options.cutoff || n < 2) {
+        // The matching slice of the buffer is free here, so it serves as scratch space.
+        NoCounting none;
+        bottomUpMergeSort(first, n, buffer, comp, none);
+        if (intoBuffer) {
+            std::copy(first, last, buffer);
+        }
+        return;
+    }
+    std::ptrdiff_t half = (n + 1) / 2;
+    std::atomic<long> pending(1);
+    pool.spawn([=, &pool, &pending, &options] {
+        parallelMergeSortTask(pool, first, first + half, buffer, !intoBuffer, comp, options);
+        pending.fetch_sub(1, std::memory_order_acq_rel);
+    });
+    parallelMergeSortTask(pool, first + half, last, buffer + half, !intoBuffer, comp, options);
+    pool.wait(pending);
+
+    if (intoBuffer) {
+        parallelMerge(pool, first, first + half, first + half, last, buffer, comp, options);
+    } else {
+        parallelMerge(pool, buffer, buffer + half, buffer + half, buffer + n, first, comp, options);
+    }
+}
+
+} // namespace detail
+
+// Fork-join merge sort: the halves are sorted as parallel tasks and merged with
+// parallelMerge, so the last merges do not serialize on one thread. Uses one buffer of n
+// elements; stable like mergeSort.
+template <typename It, typename Compare = std::less<>>
+void parallelMergeSort(It first, It last, Compare comp = Compare(), const ParallelOptions& options = ParallelOptions()) {
+    using T = typename std::iterator_traits<It>::value_type;
+    std::vector<T> buffer(first, last);
+    TaskPool pool(options.threads);
+    detail::parallelMergeSortTask(pool, first, last, buffer.begin(), false, comp, options);
+}
+
+// Natural merge sort with the runs of adaptiveMergeSort (descending ones reversed, short
+// ones extended to minRunLength(n)), merged pairwise in rounds; each round's merges run as
+// parallel tasks (each of them split further by parallelMerge once few, long runs are
+// left). Rounds alternate between the array and one buffer of n elements.
+template <typename It, typename Compare = std::less<>>
+void parallelAdaptiveMergeSort(It first, It last, Compare comp = Compare(),
+                               const ParallelOptions& options = ParallelOptions()) {
+    using T = typename std::iterator_traits<It>::value_type;
+    NoCounting none;
+    std::vector<std::pair<It, It>> found = findRuns(first, last, comp, none, minRunLength(last - first));
+    if (found.size() < 2) {
+        return;
+    }
+    // Runs as offsets, so they apply to the array and to the buffer alike.
+    std::vector<std::pair<std::ptrdiff_t, std::ptrdiff_t>> runs;
+    for (const auto& run : found) {
+        runs.emplace_back(run.first - first, run.second - first);
+    }
+
+    std::vector<T> buffer(last - first);
+    TaskPool pool(options.threads);
+    bool inBuffer = false;
+    while (runs.size() > 1) {
+        std::vector<std::pair<std::ptrdiff_t, std::ptrdiff_t>> newRuns;
+        for (std::size_t i = 0; i < runs.size(); i += 2) {
+            newRuns.emplace_back(runs[i].first, i + 1 < runs.size() ? runs[i + 1].second : runs[i].second);
+        }
+        // Neighbouring merges are batched into tasks of about options.cutoff elements; on
+        // random input the first rounds would otherwise be millions of tiny tasks.
+        std::atomic<long> pending(0);
+        for (std::size_t begin = 0; begin < newRuns.size();) {
+            std::size_t end = begin;
+            while (end < newRuns.size() && newRuns[end].second - newRuns[begin].first < options.cutoff) {
+                end++;
+            }
+            end = std::max(end, begin + 1);
+            pending.fetch_add(1, std::memory_order_relaxed);
+            pool.spawn([=, &pool, &pending, &runs, &buffer, &options] {
+                auto b = buffer.begin();
+                for (std::size_t m = begin; m < end; m++) {
+                    std::ptrdiff_t left = runs[2 * m].first, mid = runs[2 * m].second;
+                    std::ptrdiff_t right = 2 * m + 1 < runs.size() ? runs[2 * m + 1].second : mid;
+                    if (inBuffer) {
+                        parallelMerge(pool, b + left, b + mid, b + mid, b + right, first + left, comp, options);
+                    } else {
+                        parallelMerge(pool, first + left, first + mid, first + mid, first + right, b + left, comp,
+                                      options);
+                    }
+                }
+                pending.fetch_sub(1, std::memory_order_acq_rel);
+            });
+            begin = end;
+        }
+        pool.wait(pending);
+        runs.swap(newRuns);
+        inBuffer = !inBuffer;
+    }
+    if (inBuffer) {
+        parallelCopy(pool, buffer.begin(), buffer.end(), first, options);
+    }
+}
+
+} // namespace sorting
+
+#endif // PARALLEL_MERGE_SORT_HPP
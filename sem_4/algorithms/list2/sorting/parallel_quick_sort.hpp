@@ -0,0 +1,187 @@
+#ifndef PARALLEL_QUICK_SORT_HPP
+#define PARALLEL_QUICK_SORT_HPP
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <functional>
+#include <vector>
+
+#include "dual_pivot_quick_sort.hpp"
+#include "quick_sort.hpp"
+#include "task_pool.hpp"
+
+namespace sorting {
+
+// Block-wise parallel partition: every worker partitions its own block of [first, last),
+// then the elements that ended up on the wrong side of the global split point are swapped
+// across it, again split evenly between the workers. Returns m with pred true on
+// [first, m) and false on [m, last). Not stable.
+template <typename It, typename Pred>
+It parallelPartition(TaskPool& pool, It first, It last, Pred pred) {
+    std::ptrdiff_t n = last - first;
+    int blocks = pool.size();
+    std::vector<It> bounds(blocks + 1), mids(blocks);
+    for (int b = 0; b <= blocks; b++) {
+        bounds[b] = first + n * b / blocks;
+    }
+
+    std::atomic<long> pending(blocks);
+    for (int b = 0; b < blocks; b++) {
+        pool.spawn([&, b] {
+            mids[b] = std::partition(bounds[b], bounds[b + 1], pred);
+            pending.fetch_sub(1, std::memory_order_acq_rel);
+        });
+    }
+    pool.wait(pending);
+
+    It m = first;
+    for (int b = 0; b < blocks; b++) {
+        m += mids[b] - bounds[b];
+    }
+
+    // Misplaced elements: pred-false ones left of m and pred-true ones right of m. Both sides
+    // are lists of at most `blocks` intervals holding the same number of elements.
+    struct Interval {
+        It begin;
+        It end;
+    };
+    std::vector<Interval> wrongLeft, wrongRight;
+    for (int b = 0; b < blocks; b++) {
+        It falseBegin = mids[b], falseEnd = std::min(bounds[b + 1], m);
+        if (falseBegin < falseEnd) {
+            wrongLeft.push_back({falseBegin, falseEnd});
+        }
+        It trueBegin = std::max(bounds[b], m), trueEnd = mids[b];
+        if (trueBegin < trueEnd) {
+            wrongRight.push_back({trueBegin, trueEnd});
+        }
+    }
+    std::ptrdiff_t total = 0;
+    for (const Interval& interval : wrongLeft) {
+        total += interval.end - interval.begin;
+    }
+    if (total == 0) {
+        return m;
+    }
+
+    // Position k of a list of intervals, counting only the elements inside them.
+    auto locate = [](const std::vector<Interval>& list, std::ptrdiff_t k, std::size_t& index) {
+        index = 0;
+        while (k >= list[index].end - list[index].begin) {
+            k -= list[index].end - list[index].begin;
+            index++;
+        }
+        return list[index].begin + k;
+    };
+
+    pending.store(blocks, std::memory_order_relaxed);
+    for (int b = 0; b < blocks; b++) {
+        pool.spawn([&, b] {
+            std::ptrdiff_t from = total * b / blocks, to = total * (b + 1) / blocks;
+            if (from < to) {
+                std::size_t li, ri;
+                It l = locate(wrongLeft, from, li);
+                It r = locate(wrongRight, from, ri);
+                for (std::ptrdiff_t k = from; k < to; k++) {
+                    if (l == wrongLeft[li].end) {
+                        l = wrongLeft[++li].begin;
+                    }
+                    if (r == wrongRight[ri].end) {
+                        r = wrongRight[++ri].begin;
+                    }
+                    std::iter_swap(l++, r++);
+                }
+            }
+            pending.fetch_sub(1, std::memory_order_acq_rel);
+        });
+    }
+    pool.wait(pending);
+    return m;
+}
+
+namespace detail {
+
+template <typename It, typename Compare>
+void parallelQuickSortTask(TaskPool& pool, It first, It last, Compare comp, const ParallelOptions& options,
+                           std::atomic<long>& pending) {
+    NoCounting none;
+    while (last - first >= options.cutoff) {
+        It p;
+        if (last - first >= options.partitionCutoff && pool.size() > 1) {
+            It pivot = last - 1;
+            p = parallelPartition(pool, first, pivot, [&](const auto& x) { return comp(x, *pivot); });
+            std::iter_swap(p, pivot);
+        } else {
+            p = partition(first, last, comp, none);
+        }
+        pending.fetch_add(1, std::memory_order_relaxed);
+        pool.spawn([&pool, first, p, comp, &options, &pending] {
+            parallelQuickSortTask(pool, first, p, comp, options, pending);
+        });
+        first = p + 1;
+    }
+    quickSort(first, last, comp, none);
+    pending.fetch_sub(1, std::memory_order_acq_rel);
+}
+
+template <typename It, typename Compare>
+void parallelDualPivotQuickSortTask(TaskPool& pool, It first, It last, Compare comp,
+                                    const ParallelOptions& options, std::atomic<long>& pending) {
+    NoCounting none;
+    while (last - first >= options.cutoff) {
+        It lp, rp;
+        if (last - first >= options.partitionCutoff && pool.size() > 1) {
+            It low = first, high = last - 1;
+            if (comp(*high, *low)) {
+                std::iter_swap(low, high);
+            }
+            const auto& p = *low;
+            const auto& q = *high;
+            It m1 = parallelPartition(pool, low + 1, high, [&](const auto& x) { return comp(x, p); });
+            It m2 = parallelPartition(pool, m1, high, [&](const auto& x) { return !comp(q, x); });
+            lp = m1 - 1;
+            rp = m2;
+            std::iter_swap(low, lp);
+            std::iter_swap(high, rp);
+        } else {
+            dualPivotPartition(first, last, lp, rp, comp, none);
+        }
+        pending.fetch_add(2, std::memory_order_relaxed);
+        pool.spawn([&pool, first, lp, comp, &options, &pending] {
+            parallelDualPivotQuickSortTask(pool, first, lp, comp, options, pending);
+        });
+        pool.spawn([&pool, lp, rp, comp, &options, &pending] {
+            parallelDualPivotQuickSortTask(pool, lp + 1, rp, comp, options, pending);
+        });
+        first = rp + 1;
+    }
+    dualPivotQuickSort(first, last, comp, none);
+    pending.fetch_sub(1, std::memory_order_acq_rel);
+}
+
+} // namespace detail
+
+// Same pivot rules as quickSort / dualPivotQuickSort, so the parallel and sequential
+// versions do the same partitioning work. Subranges of at least options.cutoff elements are
+// forked as tasks; the large top-level partitions run in parallel themselves.
+template <typename It, typename Compare = std::less<>>
+void parallelQuickSort(It first, It last, Compare comp = Compare(), const ParallelOptions& options = ParallelOptions()) {
+    TaskPool pool(options.threads);
+    std::atomic<long> pending(1);
+    detail::parallelQuickSortTask(pool, first, last, comp, options, pending);
+    pool.wait(pending);
+}
+
+template <typename It, typename Compare = std::less<>>
+void parallelDualPivotQuickSort(It first, It last, Compare comp = Compare(),
+                                const ParallelOptions& options = ParallelOptions()) {
+    TaskPool pool(options.threads);
+    std::atomic<long> pending(1);
+    detail::parallelDualPivotQuickSortTask(pool, first, last, comp, options, pending);
+    pool.wait(pending);
+}
+
+} // namespace sorting
+
+#endif // PARALLEL_QUICK_SORT_HPP
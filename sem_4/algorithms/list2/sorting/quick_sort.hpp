@@ -0,0 +1,156 @@
+#ifndef QUICK_SORT_HPP
+#define QUICK_SORT_HPP
+
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+
+#include "simd_partition.hpp"
+#include "sort_policy.hpp"
+
+namespace sorting {
+
+// Elements scanned per block by blockPartition(); offsets into a block fit in a byte.
+const int PARTITION_BLOCK = 64;
+
+// Lomuto partition around the last element; returns the pivot's final position.
+template <typename It, typename Compare, typename Policy>
+It partition(It first, It last, Compare comp, Policy& policy) {
+    It pivot = last - 1;
+    It i = first;
+    for (It j = first; j != pivot; ++j) {
+        if (detail::less(comp, policy, *j, *pivot)) {
+            detail::swap_at(policy, i, j);
+            ++i;
+        }
+    }
+    detail::swap_at(policy, i, pivot);
+    return i;
+}
+
+// BlockQuicksort partition around the last element (Edelkamp and Weiss). A block of
+// PARTITION_BLOCK elements is scanned from each end. The scan records the offsets of the
+// misplaced elements without branching: every offset is stored and the count grows by the
+// comparison's result. Then pairs of misplaced elements are swapped in bulk, so the
+// loops have no data-dependent branch to mispredict. The last blocks are sized to what
+// remains, so every element is compared once. Returns the pivot's final position;
+// [first, p) < pivot <= [p + 1, last).
+template <typename It, typename Compare, typename Policy>
+It blockPartition(It first, It last, Compare comp, Policy& policy) {
+    It pivot = last - 1;
+    It l = first, r = pivot;
+    unsigned char offsetsL[PARTITION_BLOCK], offsetsR[PARTITION_BLOCK];
+    int numL = 0, numR = 0, startL = 0, startR = 0;
+    bool lastRound = false;
+    while (!lastRound) {
+        // [first, l) < pivot <= [r, pivot); a block with offsets left over is still in [l, r).
+        std::ptrdiff_t rest = r - l;
+        int sizeL = PARTITION_BLOCK, sizeR = PARTITION_BLOCK;
+        lastRound = rest <= 2 * PARTITION_BLOCK;
+        if (lastRound) {
+            if (numL == 0 && numR == 0) {
+                sizeL = static_cast<int>(rest / 2);
+                sizeR = static_cast<int>(rest - sizeL);
+            } else if (numL == 0) {
+                sizeL = static_cast<int>(rest - PARTITION_BLOCK);
+            } else {
+                sizeR = static_cast<int>(rest - PARTITION_BLOCK);
+            }
+        }
+        if (numL == 0) {
+            startL = 0;
+            for (int i = 0; i < sizeL; i++) {
+                offsetsL[numL] = static_cast<unsigned char>(i);
+                numL += !detail::less(comp, policy, l[i], *pivot);
+            }
+        }
+        if (numR == 0) {
+            startR = 0;
+            for (int i = 0; i < sizeR; i++) {
+                offsetsR[numR] = static_cast<unsigned char>(i);
+                numR += detail::less(comp, policy, r[-1 - i], *pivot);
+            }
+        }
+        int num = std::min(numL, numR);
+        for (int j = 0; j < num; j++) {
+            detail::swap_at(policy, l + offsetsL[startL + j], r - 1 - offsetsR[startR + j]);
+        }
+        numL -= num;
+        numR -= num;
+        startL += num;
+        startR += num;
+        // A block is done once all its misplaced elements are swapped out.
+        if (numL == 0) {
+            l += sizeL;
+        }
+        if (numR == 0) {
+            r -= sizeR;
+        }
+    }
+    // At most one block is left, and it is all of [l, r): move its misplaced elements, the
+    // farthest first, to the other end, which then is the split point.
+    if (numL > 0) {
+        while (numL > 0) {
+            numL--;
+            detail::swap_at(policy, l + offsetsL[startL + numL], --r);
+        }
+        l = r;
+    }
+    while (numR > 0) {
+        numR--;
+        detail::swap_at(policy, r - 1 - offsetsR[startR + numR], l++);
+    }
+    detail::swap_at(policy, l, pivot);
+    return l;
+}
+
+// simdPartition() around the last element for contiguous ints under std::less; n - 1
+// comparisons are counted and, as the kernel moves keys instead of swapping them, no swaps.
+// Other ranges fall back to blockPartition().
+template <typename It, typename Compare, typename Policy>
+It vectorPartition(It first, It last, Compare comp, Policy& policy) {
+    if constexpr (detail::is_simd_partitionable<It, Compare>::value) {
+        std::ptrdiff_t n = last - first;
+        int* base = &*first;
+        int* m = simdPartition(base, base + n - 1, base[n - 1]);
+        for (std::ptrdiff_t i = 1; i < n; i++) {
+            policy.count_comparison();
+        }
+        std::iter_swap(m, base + n - 1);
+        return first + (m - base);
+    } else {
+        return blockPartition(first, last, comp, policy);
+    }
+}
+
+template <typename It, typename Compare, typename Policy>
+It partition(It first, It last, PartitionScheme scheme, Compare comp, Policy& policy) {
+    if (scheme == PartitionScheme::BLOCK) {
+        return blockPartition(first, last, comp, policy);
+    }
+    if (scheme == PartitionScheme::SIMD) {
+        return vectorPartition(first, last, comp, policy);
+    }
+    return partition(first, last, comp, policy);
+}
+
+template <typename It, typename Compare, typename Policy>
+void quickSort(It first, It last, Compare comp, Policy& policy, PartitionScheme scheme = PartitionScheme::LOMUTO) {
+    if (last - first < 2) {
+        return;
+    }
+    It p = partition(first, last, scheme, comp, policy);
+    policy.trace(SortEvent::PARTITIONED, first, last, p, p);
+    quickSort(first, p, comp, policy, scheme);
+    quickSort(p + 1, last, comp, policy, scheme);
+}
+
+template <typename It, typename Compare = std::less<>>
+void quickSort(It first, It last, Compare comp = Compare()) {
+    NoCounting none;
+    quickSort(first, last, comp, none);
+}
+
+} // namespace sorting
+
+#endif // QUICK_SORT_HPP
@@ -0,0 +1,225 @@
+#ifndef RADIX_SORT_HPP
+#define RADIX_SORT_HPP
+
+#include <algorithm>
+#include <climits>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <iterator>
+#include <type_traits>
+#include <vector>
+
+#include "insertion_sort.hpp"
+#include "sort_policy.hpp"
+
+namespace sorting {
+
+// Default digit width; 11 and 16 bits trade larger histograms for fewer passes.
+const int RADIX_DIGIT_BITS = 8;
+// American flag sort leaves buckets this small to insertion sort.
+const std::ptrdiff_t RADIX_INSERTION_CUTOFF = 32;
+
+enum class RadixMode {
+    LSD,
+    MSD_IN_PLACE
+};
+
+// Order-preserving maps of keys to unsigned integers: x < y exactly when radixKey(x) <
+// radixKey(y). Unsigned keys stay as they are, signed ones get their sign bit flipped, and
+// for floating point negative numbers are complemented and the others get the sign bit set.
+// (So -0.0 sorts before 0.0, and NaNs end up at the ends by their sign.)
+template <typename T, typename Enable = void>
+struct RadixTraits;
+
+template <typename T>
+struct RadixTraits<T, typename std::enable_if<std::is_integral<T>::value>::type> {
+    using Key = typename std::make_unsigned<T>::type;
+    static Key key(T x) {
+        Key k = static_cast<Key>(x);
+        if (std::is_signed<T>::value) {
+            k ^= Key(1) << (sizeof(Key) * CHAR_BIT - 1);
+        }
+        return k;
+    }
+};
+
+template <typename T>
+struct RadixTraits<T, typename std::enable_if<std::is_floating_point<T>::value>::type> {
+    static_assert(sizeof(T) == 4 || sizeof(T) == 8, "radix sort handles float and double");
+    using Key = typename std::conditional<sizeof(T) == 4, std::uint32_t, std::uint64_t>::type;
+    static Key key(T x) {
+        Key k;
+        std::memcpy(&k, &x, sizeof(k));
+        const Key sign = Key(1) << (sizeof(Key) * CHAR_BIT - 1);
+        return (k & sign) ? ~k : (k | sign);
+    }
+};
+
+template <typename T>
+typename RadixTraits<T>::Key radixKey(const T& x) {
+    return RadixTraits<T>::key(x);
+}
+
+namespace detail {
+
+template <typename T>
+struct RadixDigit {
+    using Key = typename RadixTraits<T>::Key;
+    int shift;
+    Key mask;
+    std::size_t operator()(const T& x) const { return static_cast<std::size_t>((radixKey(x) >> shift) & mask); }
+};
+
+template <typename T>
+RadixDigit<T> radixDigit(int digit, int digitBits) {
+    using Key = typename RadixTraits<T>::Key;
+    return RadixDigit<T>{digit * digitBits, static_cast<Key>((std::uintmax_t(1) << digitBits) - 1)};
+}
+
+template <typename T>
+int radixDigits(int digitBits) {
+    int bits = static_cast<int>(sizeof(typename RadixTraits<T>::Key) * CHAR_BIT);
+    return (bits + digitBits - 1) / digitBits;
+}
+
+// LSD: the histograms of all digits are taken in one read of the input, then every digit
+// whose histogram is not trivial (all keys in one bucket) is scattered stably into the
+// other array, alternating between the range and one buffer of n elements.
+template <typename It, typename Policy>
+void lsdRadixSort(It first, It last, int digitBits, Policy& policy) {
+    using T = typename std::iterator_traits<It>::value_type;
+    std::ptrdiff_t n = last - first;
+    int digits = radixDigits<T>(digitBits);
+    std::size_t radix = std::size_t(1) << digitBits;
+    std::vector<std::size_t> counts(digits * radix, 0);
+    for (It it = first; it != last; ++it) {
+        for (int d = 0; d < digits; d++) {
+            counts[d * radix + radixDigit<T>(d, digitBits)(*it)]++;
+        }
+    }
+
+    std::vector<T> buffer;
+    auto b = buffer.begin();
+    bool inBuffer = false;
+    for (int d = 0; d < digits; d++) {
+        std::size_t* count = &counts[d * radix];
+        if (std::count(count, count + radix, static_cast<std::size_t>(n)) > 0) {
+            continue;
+        }
+        if (buffer.empty()) {
+            buffer.assign(first, last);
+            b = buffer.begin();
+        }
+        std::size_t offset = 0;
+        for (std::size_t v = 0; v < radix; v++) {
+            std::size_t c = count[v];
+            count[v] = offset;
+            offset += c;
+        }
+        RadixDigit<T> digit = radixDigit<T>(d, digitBits);
+        if (inBuffer) {
+            for (auto it = b; it != b + n; ++it) {
+                first[count[digit(*it)]++] = std::move(*it);
+            }
+            policy.trace(SortEvent::DIGIT_PASS, first, last, first, first);
+        } else {
+            for (It it = first; it != last; ++it) {
+                b[count[digit(*it)]++] = std::move(*it);
+            }
+            policy.trace(SortEvent::DIGIT_PASS, b, b + n, first, first);
+        }
+        inBuffer = !inBuffer;
+    }
+    if (inBuffer) {
+        std::move(b, b + n, first);
+    }
+}
+
+// American flag sort of [first, last) by digit d and then, bucket by bucket, the lower
+// ones. Each element is swapped straight into its bucket (one swap places one element),
+// so the only extra memory is a histogram per digit level, kept in levels.
+template <typename It, typename Policy>
+void americanFlagSort(It first, It last, int d, int digitBits, std::vector<std::vector<std::size_t>>& levels,
+                      Policy& policy) {
+    using T = typename std::iterator_traits<It>::value_type;
+    std::ptrdiff_t n = last - first;
+    if (n <= RADIX_INSERTION_CUTOFF) {
+        auto byKey = [](const T& a, const T& b) { return radixKey(a) < radixKey(b); };
+        insertionSort(first, last, byKey, policy);
+        return;
+    }
+    std::size_t radix = std::size_t(1) << digitBits;
+    RadixDigit<T> digit = radixDigit<T>(d, digitBits);
+    std::vector<std::size_t>& next = levels[2 * d];
+    std::vector<std::size_t>& end = levels[2 * d + 1];
+    std::fill(end.begin(), end.end(), 0);
+    for (It it = first; it != last; ++it) {
+        end[digit(*it)]++;
+    }
+    bool trivial = std::count(end.begin(), end.end(), static_cast<std::size_t>(n)) > 0;
+    if (!trivial) {
+        std::size_t offset = 0;
+        for (std::size_t v = 0; v < radix; v++) {
+            next[v] = offset;
+            offset += end[v];
+            end[v] = offset;
+        }
+        for (std::size_t v = 0; v < radix; v++) {
+            while (next[v] < end[v]) {
+                std::size_t c = digit(first[next[v]]);
+                if (c == v) {
+                    next[v]++;
+                } else {
+                    swap_at(policy, first + next[v], first + next[c]++);
+                }
+            }
+        }
+        policy.trace(SortEvent::DIGIT_PASS, first, last, first, first);
+    }
+    if (d == 0) {
+        return;
+    }
+    if (trivial) {
+        americanFlagSort(first, last, d - 1, digitBits, levels, policy);
+        return;
+    }
+    // The buckets recurse on the next level's histograms, so end[] stays intact.
+    for (std::size_t v = 0, start = 0; v < radix; start = end[v], v++) {
+        if (end[v] - start > 1) {
+            americanFlagSort(first + start, first + end[v], d - 1, digitBits, levels, policy);
+        }
+    }
+}
+
+} // namespace detail
+
+// Radix sort of integer or floating-point keys (see RadixTraits) with digits of digitBits
+// bits (1 to 16). LSD is stable and uses one buffer of n elements; MSD_IN_PLACE is the
+// American flag sort, which is not stable but needs only (2 << digitBits) counters per
+// digit. Passes on which all keys share the digit are skipped in both modes. Comparisons
+// are only counted for the small buckets the MSD mode insertion-sorts.
+template <typename It, typename Policy>
+void radixSort(It first, It last, int digitBits, RadixMode mode, Policy& policy) {
+    using T = typename std::iterator_traits<It>::value_type;
+    if (last - first < 2) {
+        return;
+    }
+    if (mode == RadixMode::LSD) {
+        detail::lsdRadixSort(first, last, digitBits, policy);
+        return;
+    }
+    int digits = detail::radixDigits<T>(digitBits);
+    std::vector<std::vector<std::size_t>> levels(2 * digits, std::vector<std::size_t>(std::size_t(1) << digitBits));
+    detail::americanFlagSort(first, last, digits - 1, digitBits, levels, policy);
+}
+
+template <typename It>
+void radixSort(It first, It last, int digitBits = RADIX_DIGIT_BITS, RadixMode mode = RadixMode::LSD) {
+    NoCounting none;
+    radixSort(first, last, digitBits, mode, none);
+}
+
+} // namespace sorting
+
+#endif // RADIX_SORT_HPP
@@ -0,0 +1,200 @@
+#ifndef SIMD_PARTITION_HPP
+#define SIMD_PARTITION_HPP
+
+#include <array>
+#include <cstdint>
+#include <functional>
+#include <type_traits>
+#include <vector>
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define SORTING_SIMD_X86 1
+#include <immintrin.h>
+#endif
+
+// In-place partition of int keys by a bound: [first, m) < bound <= [m, last). The vector
+// kernels compare a whole register of keys (8 with AVX2, 16 with AVX-512) against the
+// bound at once and store the smaller keys to the left end and the others to the right end
+// of the free space; the CPU is checked once at runtime and a branchless scalar loop is
+// used where neither instruction set is available. Not stable.
+
+namespace sorting {
+
+namespace detail {
+
+// Branchless Lomuto: every key is swapped to the left end, which only advances when the
+// key is below the bound.
+inline int* partitionBelowScalar(int* first, int* last, int bound) {
+    int* left = first;
+    for (int* i = first; i != last; ++i) {
+        int x = *i;
+        *i = *left;
+        *left = x;
+        left += x < bound;
+    }
+    return left;
+}
+
+#ifdef SORTING_SIMD_X86
+
+// The vector kernels read the first and the last register of keys up front, which leaves
+// exactly two registers of free space. After that, each step reads a register from the
+// end whose free space is smaller, so both ends always have room for the keys written to
+// them. The tail that does not fill a register goes one key at a time, and the two saved
+// registers go last. The ranges must hold at least two registers of keys.
+
+// For every 8-bit mask, the lane order that puts the set lanes first, in order.
+struct CompressTable {
+    std::array<std::array<std::int32_t, 8>, 256> lanes{};
+
+    constexpr CompressTable() {
+        for (int mask = 0; mask < 256; mask++) {
+            int k = 0;
+            for (int lane = 0; lane < 8; lane++) {
+                if (mask & (1 << lane)) {
+                    lanes[mask][k++] = lane;
+                }
+            }
+            for (int lane = 0; lane < 8; lane++) {
+                if (!(mask & (1 << lane))) {
+                    lanes[mask][k++] = lane;
+                }
+            }
+        }
+    }
+};
+
+// Moves the keys below the bound left of the remaining free space and the others right of
+// it, one key at a time, reading from [readL, readR).
+inline void partitionTail(int*& readL, int*& readR, int*& writeL, int*& writeR, int bound) {
+    while (readL != readR) {
+        int x = (readL - writeL <= writeR - readR) ? *readL++ : *--readR;
+        if (x < bound) {
+            *writeL++ = x;
+        } else {
+            *--writeR = x;
+        }
+    }
+}
+
+__attribute__((target("avx2"))) inline void storeAvx2(__m256i v, __m256i bounds, int*& writeL, int*& writeR) {
+    static constexpr CompressTable table;
+    int mask = _mm256_movemask_ps(_mm256_castsi256_ps(_mm256_cmpgt_epi32(bounds, v)));
+    int below = __builtin_popcount(mask);
+    __m256i order = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(table.lanes[mask].data()));
+    __m256i packed = _mm256_permutevar8x32_epi32(v, order);
+    // Both stores write a whole register; the lanes that do not belong there land in free
+    // space and are overwritten later.
+    _mm256_storeu_si256(reinterpret_cast<__m256i*>(writeL), packed);
+    _mm256_storeu_si256(reinterpret_cast<__m256i*>(writeR - 8), packed);
+    writeL += below;
+    writeR -= 8 - below;
+}
+
+__attribute__((target("avx2"))) inline int* partitionBelowAvx2(int* first, int* last, int bound) {
+    const int W = 8;
+    __m256i bounds = _mm256_set1_epi32(bound);
+    __m256i savedL = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(first));
+    __m256i savedR = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(last - W));
+    int *readL = first + W, *readR = last - W, *writeL = first, *writeR = last;
+    while (readR - readL >= W) {
+        __m256i v;
+        if (readL - writeL <= writeR - readR) {
+            v = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(readL));
+            readL += W;
+        } else {
+            readR -= W;
+            v = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(readR));
+        }
+        storeAvx2(v, bounds, writeL, writeR);
+    }
+    partitionTail(readL, readR, writeL, writeR, bound);
+    storeAvx2(savedL, bounds, writeL, writeR);
+    storeAvx2(savedR, bounds, writeL, writeR);
+    return writeL;
+}
+
+__attribute__((target("avx512f"))) inline void storeAvx512(__m512i v, __m512i bounds, int*& writeL, int*& writeR) {
+    __mmask16 mask = _mm512_cmplt_epi32_mask(v, bounds);
+    int below = __builtin_popcount(mask);
+    _mm512_mask_compressstoreu_epi32(writeL, mask, v);
+    _mm512_mask_compressstoreu_epi32(writeR - (16 - below), static_cast<__mmask16>(~mask), v);
+    writeL += below;
+    writeR -= 16 - below;
+}
+
+__attribute__((target("avx512f"))) inline int* partitionBelowAvx512(int* first, int* last, int bound) {
+    const int W = 16;
+    __m512i bounds = _mm512_set1_epi32(bound);
+    __m512i savedL = _mm512_loadu_si512(first);
+    __m512i savedR = _mm512_loadu_si512(last - W);
+    int *readL = first + W, *readR = last - W, *writeL = first, *writeR = last;
+    while (readR - readL >= W) {
+        __m512i v;
+        if (readL - writeL <= writeR - readR) {
+            v = _mm512_loadu_si512(readL);
+            readL += W;
+        } else {
+            readR -= W;
+            v = _mm512_loadu_si512(readR);
+        }
+        storeAvx512(v, bounds, writeL, writeR);
+    }
+    partitionTail(readL, readR, writeL, writeR, bound);
+    storeAvx512(savedL, bounds, writeL, writeR);
+    storeAvx512(savedR, bounds, writeL, writeR);
+    return writeL;
+}
+
+#endif // SORTING_SIMD_X86
+
+// Ranges the vector kernel handles: ints in contiguous memory ordered by std::less.
+template <typename It, typename Compare>
+struct is_simd_partitionable
+    : std::integral_constant<bool,
+                             (std::is_same<It, int*>::value || std::is_same<It, std::vector<int>::iterator>::value) &&
+                                 (std::is_same<Compare, std::less<>>::value ||
+                                  std::is_same<Compare, std::less<int>>::value)> {};
+
+enum class SimdLevel {
+    SCALAR,
+    AVX2,
+    AVX512
+};
+
+inline SimdLevel detectSimdLevel() {
+#ifdef SORTING_SIMD_X86
+    if (__builtin_cpu_supports("avx512f")) {
+        return SimdLevel::AVX512;
+    }
+    if (__builtin_cpu_supports("avx2")) {
+        return SimdLevel::AVX2;
+    }
+#endif
+    return SimdLevel::SCALAR;
+}
+
+} // namespace detail
+
+// The instruction set simdPartition() runs on this machine: "avx512", "avx2" or "scalar".
+inline const char* simdPartitionIsa() {
+    static const detail::SimdLevel level = detail::detectSimdLevel();
+    return level == detail::SimdLevel::AVX512 ? "avx512" : level == detail::SimdLevel::AVX2 ? "avx2" : "scalar";
+}
+
+inline int* simdPartition(int* first, int* last, int bound) {
+    static const detail::SimdLevel level = detail::detectSimdLevel();
+#ifdef SORTING_SIMD_X86
+    if (level == detail::SimdLevel::AVX512 && last - first >= 32) {
+        return detail::partitionBelowAvx512(first, last, bound);
+    }
+    if (level != detail::SimdLevel::SCALAR && last - first >= 16) {
+        return detail::partitionBelowAvx2(first, last, bound);
+    }
+#endif
+    return detail::partitionBelowScalar(first, last, bound);
+}
+
+} // namespace sorting
+
+#endif // SIMD_PARTITION_HPP
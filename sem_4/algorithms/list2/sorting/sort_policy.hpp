@@ -0,0 +1,91 @@
+#ifndef SORT_POLICY_HPP
+#define SORT_POLICY_HPP
+
+#include <algorithm>
+
+// Every sorter in this library takes a Policy& next to its comparator. The sorters call
+// policy.count_comparison() / policy.count_swap() for each key comparison / swap and
+// policy.trace(...) after every notable step. NoCounting does nothing and is empty, so
+// with it all of that inlines away and the sorters are plain templated sorts.
+
+namespace sorting {
+
+// What a trace() call reports. The iterators passed along are [first, last) of the range
+// involved plus up to two marks:
+//   INSERTION_PASS  insertion sort finished one outer pass; mark = the element it inserted
+//   PARTITIONED     a range was partitioned; marks = the final pivot positions (twice for one pivot)
+//   SORTED          a range handled as a whole is now sorted (base case of the recursive sorts,
+//                   dual-pivot call)
+//   RUN_FOUND       adaptive merge sort has the run [first, last) ready (reversed if it was
+//                   descending, extended if it was short); mark = first
+//   MERGED          [first, last) holds a freshly merged range, which may lie in the sort's
+//                   scratch buffer; mark = where that range sits in the array being sorted
+//   DIGIT_PASS      radix sort distributed [first, last) by one digit; like MERGED, the
+//                   range may lie in the scratch buffer and mark = its place in the array
+// The range and the marks may be different iterator types when the range is in the buffer.
+enum class SortEvent {
+    INSERTION_PASS,
+    PARTITIONED,
+    SORTED,
+    RUN_FOUND,
+    MERGED,
+    DIGIT_PASS
+};
+
+// How the quicksorts split a range. LOMUTO and BLOCK (see blockPartition) apply to the
+// single-pivot sorts; the dual-pivot sort uses its own count-based partition for both.
+// SIMD runs the vector kernel of simd_partition.hpp on int ranges and falls back to BLOCK
+// (single pivot) or the count-based partition (dual pivot) for anything else.
+enum class PartitionScheme {
+    LOMUTO,
+    BLOCK,
+    SIMD
+};
+
+// How the recursive sorts finish small ranges: with insertion sort or with the sorting
+// network for the range's size (sorting_network.hpp), up to MAX_NETWORK_SIZE elements.
+// NONE has no base case: dualPivotQuickSort recurses down to single elements and mergeSort
+// merges from runs of one. hybridQuickSort, whose threshold is its base case, then uses
+// insertion sort.
+enum class BaseCase {
+    NONE,
+    INSERTION,
+    NETWORK
+};
+
+struct NoCounting {
+    void count_comparison() {}
+    void count_swap() {}
+    template <typename It, typename Mark>
+    void trace(SortEvent, It, It, Mark, Mark) {}
+};
+
+struct CountingPolicy {
+    long long comparisons = 0;
+    long long swaps = 0;
+
+    void count_comparison() { comparisons++; }
+    void count_swap() { swaps++; }
+    template <typename It, typename Mark>
+    void trace(SortEvent, It, It, Mark, Mark) {}
+};
+
+namespace detail {
+
+template <typename Compare, typename Policy, typename T>
+inline bool less(Compare& comp, Policy& policy, const T& a, const T& b) {
+    policy.count_comparison();
+    return comp(a, b);
+}
+
+template <typename It, typename Policy>
+inline void swap_at(Policy& policy, It a, It b) {
+    policy.count_swap();
+    std::iter_swap(a, b);
+}
+
+} // namespace detail
+
+} // namespace sorting
+
+#endif // SORT_POLICY_HPP
@@ -0,0 +1,21 @@
+#ifndef SORTING_HPP
+#define SORTING_HPP
+
+// Header-only sorting library: every sorter is templated on a random-access iterator, a
+// comparator and a counting policy (see sort_policy.hpp). The radix sort takes no
+// comparator; it orders integer and floating-point keys by their bits.
+
+#include "sort_policy.hpp"
+#include "simd_partition.hpp"
+#include "sorting_network.hpp"
+#include "insertion_sort.hpp"
+#include "quick_sort.hpp"
+#include "heap_sort.hpp"
+#include "intro_sort.hpp"
+#include "dual_pivot_quick_sort.hpp"
+#include "hybrid_sort.hpp"
+#include "merge_sort.hpp"
+#include "adaptive_merge_sort.hpp"
+#include "radix_sort.hpp"
+
+#endif // SORTING_HPP
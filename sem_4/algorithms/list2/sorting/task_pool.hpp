@@ -0,0 +1,144 @@
+#ifndef TASK_POOL_HPP
+#define TASK_POOL_HPP
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "../../list1/work_stealing_deque.h"
+
+namespace sorting {
+
+struct ParallelOptions {
+    // Upper bound on the number of threads, the calling thread included.
+    int threads = static_cast<int>(std::max(1u, std::thread::hardware_concurrency()));
+    // Ranges shorter than this are sorted (or merged) sequentially inside one task.
+    std::ptrdiff_t cutoff = 1 << 14;
+    // Ranges at least this long are partitioned block-wise by all workers together.
+    std::ptrdiff_t partitionCutoff = 1 << 20;
+};
+
+// Fork-join pool on top of the Chase-Lev deque from list1. Worker 0 is the thread that
+// created the pool; size() - 1 more threads are started. spawn() pushes onto the calling
+// worker's own deque, idle workers steal from the others. wait() does not block: the
+// waiting worker keeps running tasks until its counter drops to zero, so a task may itself
+// spawn children and wait for them.
+//
+// spawn() and wait() may only be called from the pool's workers (including the creator).
+class TaskPool {
+private:
+    struct Task {
+        virtual ~Task() {}
+        virtual void run() = 0;
+    };
+
+    template <typename F>
+    struct FunctionTask : Task {
+        F f;
+        explicit FunctionTask(F&& f) : f(std::move(f)) {}
+        void run() override { f(); }
+    };
+
+    struct Worker {
+        const TaskPool* pool;
+        int id;
+    };
+
+    static Worker& current() {
+        thread_local Worker worker{nullptr, 0};
+        return worker;
+    }
+
+    std::vector<std::unique_ptr<WorkStealingDeque<Task*>>> deques;
+    std::vector<std::thread> threads;
+    std::atomic<bool> stop;
+
+    int worker_id() const {
+        Worker& worker = current();
+        return worker.pool == this ? worker.id : 0;
+    }
+
+    // Runs one task from our own deque or, failing that, one stolen from another worker.
+    bool run_one(int id, std::uint32_t& seed) {
+        Task* task;
+        bool found = deques[id]->pop(task);
+        int n = static_cast<int>(deques.size());
+        if (!found && n > 1) {
+            seed ^= seed << 13;
+            seed ^= seed >> 17;
+            seed ^= seed << 5;
+            int start = static_cast<int>(seed % n);
+            for (int k = 0; k < n && !found; k++) {
+                int victim = (start + k) % n;
+                found = victim != id && deques[victim]->steal(task);
+            }
+        }
+        if (!found) {
+            return false;
+        }
+        task->run();
+        delete task;
+        return true;
+    }
+
+public:
+    explicit TaskPool(int threadCount) : stop(false) {
+        if (threadCount < 1) {
+            threadCount = 1;
+        }
+        for (int i = 0; i < threadCount; i++) {
+            deques.emplace_back(new WorkStealingDeque<Task*>());
+        }
+        current() = Worker{this, 0};
+        for (int i = 1; i < threadCount; i++) {
+            threads.emplace_back([this, i] {
+                current() = Worker{this, i};
+                std::uint32_t seed = 2463534242u + i;
+                while (!stop.load(std::memory_order_acquire)) {
+                    if (!run_one(i, seed)) {
+                        std::this_thread::yield();
+                    }
+                }
+            });
+        }
+    }
+
+    ~TaskPool() {
+        stop.store(true, std::memory_order_release);
+        for (std::thread& t : threads) {
+            t.join();
+        }
+        if (current().pool == this) {
+            current() = Worker{nullptr, 0};
+        }
+    }
+
+    TaskPool(const TaskPool&) = delete;
+    TaskPool& operator=(const TaskPool&) = delete;
+
+    int size() const { return static_cast<int>(deques.size()); }
+
+    template <typename F>
+    void spawn(F f) {
+        deques[worker_id()]->push(new FunctionTask<F>(std::move(f)));
+    }
+
+    void wait(const std::atomic<long>& pending) {
+        int id = worker_id();
+        std::uint32_t seed = 88675123u + id;
+        while (pending.load(std::memory_order_acquire) != 0) {
+            if (!run_one(id, seed)) {
+                std::this_thread::yield();
+            }
+        }
+    }
+};
+
+} // namespace sorting
+
+#endif // TASK_POOL_HPP
@@ -0,0 +1,83 @@
+#ifndef TUNING_HPP
+#define TUNING_HPP
+
+#include <algorithm>
+#include <cstddef>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "dual_pivot_quick_sort.hpp"
+#include "hybrid_sort.hpp"
+#include "task_pool.hpp"
+
+namespace sorting {
+
+// Config file written by ex1_2_4/autotune and read by the drivers from their working
+// directory. One line per input size class, '#' starts a comment:
+//   size hybrid_threshold dual_pivot_base_size parallel_cutoff
+// where size is the input size the line was tuned at.
+const char* const TUNING_FILE = "sorting_tuning.cfg";
+
+// Parameters for one input size class; the defaults are the library's constants.
+struct Tuning {
+    std::ptrdiff_t size = 0;
+    int hybridThreshold = HYBRID_THRESHOLD;
+    std::ptrdiff_t dualPivotBaseSize = DUAL_PIVOT_BASE_SIZE;
+    std::ptrdiff_t parallelCutoff = ParallelOptions().cutoff;
+};
+
+// All size classes in the file, ordered by size. A missing file gives none; malformed
+// lines are skipped.
+inline std::vector<Tuning> readTunings(const std::string& path = TUNING_FILE) {
+    std::vector<Tuning> tunings;
+    std::ifstream in(path);
+    std::string line;
+    while (std::getline(in, line)) {
+        line = line.substr(0, line.find('#'));
+        std::istringstream fields(line);
+        Tuning t;
+        if (fields >> t.size >> t.hybridThreshold >> t.dualPivotBaseSize >> t.parallelCutoff && t.size > 0 &&
+            t.hybridThreshold >= 0 && t.dualPivotBaseSize >= 1 && t.parallelCutoff >= 2) {
+            tunings.push_back(t);
+        }
+    }
+    std::sort(tunings.begin(), tunings.end(), [](const Tuning& a, const Tuning& b) { return a.size < b.size; });
+    return tunings;
+}
+
+// Parameters for inputs of n elements: the class tuned at the smallest size not below n,
+// or the largest one for bigger inputs; the defaults when the file has none.
+inline Tuning loadTuning(std::ptrdiff_t n, const std::string& path = TUNING_FILE) {
+    std::vector<Tuning> tunings = readTunings(path);
+    for (const Tuning& t : tunings) {
+        if (n <= t.size) {
+            return t;
+        }
+    }
+    return tunings.empty() ? Tuning() : tunings.back();
+}
+
+// Stores tuning as the class for its size, replacing the one tuned at the same size and
+// keeping the others. Returns false if the file cannot be written.
+inline bool saveTuning(const Tuning& tuning, const std::string& path = TUNING_FILE) {
+    std::vector<Tuning> tunings = readTunings(path);
+    tunings.erase(std::remove_if(tunings.begin(), tunings.end(),
+                                 [&](const Tuning& t) { return t.size == tuning.size; }),
+                  tunings.end());
+    tunings.push_back(tuning);
+    std::sort(tunings.begin(), tunings.end(), [](const Tuning& a, const Tuning& b) { return a.size < b.size; });
+
+    std::ofstream out(path);
+    out << "# size hybrid_threshold dual_pivot_base_size parallel_cutoff" << '\n';
+    for (const Tuning& t : tunings) {
+        out << t.size << ' ' << t.hybridThreshold << ' ' << t.dualPivotBaseSize << ' ' << t.parallelCutoff << '\n';
+    }
+    out.close();
+    return !out.fail();
+}
+
+} // namespace sorting
+
+#endif // TUNING_HPP
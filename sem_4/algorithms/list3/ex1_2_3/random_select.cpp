@@ -2,12 +2,16 @@
 #include <vector>
 #include <algorithm>
 #include <random>
+#include <string>
+#include "../../list2/sorting/array_file.hpp"
+#include "../../list2/sorting/simd_partition.hpp"
 
 using namespace std;
 
 int comparisons = 0;
 int swaps = 0;
 bool verbose = true;
+bool simd = false;
 
 int compare(int a, int b) {
     comparisons++;
@@ -32,6 +36,17 @@ int partition(vector<int>& A, int left, int right, mt19937& rng) {
     int pivotIndex = dist(rng);
     doSwap(A[pivotIndex], A[right]);
     int pivot = A[right];
+
+    if (simd) {
+        // Vector kernel: [left, m) < pivot <= [m, right), one comparison per element and no
+        // swaps counted except the pivot's.
+        int* m = sorting::simdPartition(&A[left], &A[right], pivot);
+        comparisons += right - left;
+        int q = static_cast<int>(m - A.data());
+        doSwap(A[q], A[right]);
+        return q;
+    }
+
     int i = left - 1;
 
     for (int j = left; j < right; ++j) {
@@ -59,20 +74,23 @@ int randomizedSelect(vector<int>& A, int left, int right, int k, mt19937& rng) {
 
 int main(int argc, char* argv[]) {
     int n, k;
-    cin >> n;
 
     if (argc < 2) {
-        cerr << "Usage: ./randomized_select k [--silent]" << endl;
+        cerr << "Usage: ./randomized_select k [--silent] [--simd]" << endl;
         return 1;
     }
 
     k = stoi(argv[1]);
-    if (argc >= 3 && string(argv[2]) == "--silent") {
-        verbose = false;
+    for (int i = 2; i < argc; i++) {
+        if (string(argv[i]) == "--silent") {
+            verbose = false;
+        } else if (string(argv[i]) == "--simd") {
+            simd = true;
+        }
     }
 
-    vector<int> A(n);
-    for (int i = 0; i < n; i++) cin >> A[i];
+    vector<int> A = sorting::readStdinArray();
+    n = A.size();
 
     vector<int> original = A;
 
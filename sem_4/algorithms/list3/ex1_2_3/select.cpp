@@ -2,6 +2,7 @@
 #include <vector>
 #include <algorithm>
 #include <random>
+#include "../../list2/sorting/array_file.hpp"
 
 using namespace std;
 
@@ -90,8 +91,6 @@ int medianOfMedians(vector<int>& A, int left, int right) {
 
 int main(int argc, char* argv[]) {
     int n, k;
-    cin >> n;
-    arraySize = n;
 
     if (argc < 2) {
         cerr << "Usage: ./select k [--silent]" << endl;
@@ -108,8 +107,9 @@ int main(int argc, char* argv[]) {
         groupSize = stoi(argv[3]);
     }
 
-    vector<int> A(n);
-    for (int i = 0; i < n; i++) cin >> A[i];
+    vector<int> A = sorting::readStdinArray();
+    n = A.size();
+    arraySize = n;
 
     vector<int> original = A;
 
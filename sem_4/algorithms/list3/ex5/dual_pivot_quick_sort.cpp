@@ -2,6 +2,7 @@
 #include <vector>
 #include <iomanip>
 #include <algorithm>
+#include "../../list2/sorting/array_file.hpp"
 using namespace std;
 
 int comparisons = 0;
@@ -103,14 +104,9 @@ void dualPivotQuickSort(vector<int>& arr, int low, int high, int n) {
 }
 
 int main() {
-    int n;
-    cin >> n;
-    vector<int> arr(n), original(n);
-
-    for (int i = 0; i < n; i++) {
-        cin >> arr[i];
-        original[i] = arr[i];
-    }
+    vector<int> arr = sorting::readStdinArray();
+    int n = arr.size();
+    vector<int> original = arr;
 
     if (n < 40) {
         cout << "Initial array:" << endl;
@@ -2,6 +2,7 @@
 #include <iostream>
 #include <vector>
 #include <iomanip>
+#include "../../list2/sorting/array_file.hpp"
 using namespace std;
 
 extern int comparisons;
@@ -115,13 +116,9 @@ void dualPivotQuickSort(vector<int>& A, int low, int high, int n) {
 }
 
 int main() {
-    int n; 
-    cin >> n;
-    vector<int> A(n), original(n);
-    for (int i = 0; i < n; i++) {
-        cin >> A[i];
-        original[i] = A[i];
-    }
+    vector<int> A = sorting::readStdinArray();
+    int n = A.size();
+    vector<int> original = A;
     if (n < 40) {
         cout << "Initial array:\n";
         printArray(original);